@@ -0,0 +1,103 @@
+/************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_mission_cfg.h
+**
+** Purpose:
+**  Define ros App mission configuration shared by flight software, tables
+**  and ground tools
+**
+** Notes:
+**
+*************************************************************************/
+#ifndef _ros_app_mission_cfg_h_
+#define _ros_app_mission_cfg_h_
+
+/*
+** /rosout severity classes, in increasing order of importance.  Every
+** per-severity array in messages and tables is indexed by these.
+*/
+#define ROS_APP_SEVERITY_DEBUG 0
+#define ROS_APP_SEVERITY_INFO  1
+#define ROS_APP_SEVERITY_WARN  2
+#define ROS_APP_SEVERITY_ERROR 3
+#define ROS_APP_SEVERITY_FATAL 4
+
+#define ROS_APP_SEVERITY_COUNT 5
+
+/*
+** Node names in tables are compared against the /rosout name field
+*/
+#define ROS_APP_NODE_NAME_BYTES 32
+
+/*
+** Alert pattern table.  Patterns are matched as a bit set, so the pattern
+** count must not exceed 32.
+*/
+#define ROS_APP_ALERT_MAX_PATTERNS  16
+#define ROS_APP_ALERT_PATTERN_BYTES 32 /* Including the terminating NUL */
+
+/*
+** Per-node sampling overrides in the app table
+*/
+#define ROS_APP_SAMPLE_MAX_NODES 8
+
+/*
+** Per-node severity thresholds in the app table
+*/
+#define ROS_APP_FILTER_MAX_NODES 16
+
+/*
+** Per-node silence thresholds in the app table
+*/
+#define ROS_APP_LIVENESS_TABLE_NODES 16
+
+/*
+** Distinct log product MIDs that get their own sequence counts
+*/
+#define ROS_APP_SEQ_MAX_PRODUCTS 8
+
+/*
+** Per-app filters for forwarding cFE events to ROS.  App names are
+** compared against the EVS packet's AppName, CFE_MISSION_MAX_API_LEN long.
+*/
+#define ROS_APP_EVS_MAX_FILTERS    8
+#define ROS_APP_EVS_APP_NAME_BYTES 20
+
+/*
+** Rollup summaries.  Nodes seen after the first ROS_APP_ROLLUP_MAX_NODES
+** in an interval are counted together, and ERROR/FATAL text is cut to
+** ROS_APP_ROLLUP_TEXT_BYTES.  A full summary must fit in
+** ROS_APP_SCHED_MAX_PACKET_BYTES.
+*/
+#define ROS_APP_ROLLUP_MAX_NODES  16
+#define ROS_APP_ROLLUP_TEXT_BYTES 64
+
+/*
+** Last-value cache dump.  Text is cut to ROS_APP_LVC_TEXT_BYTES.
+*/
+#define ROS_APP_LVC_TEXT_BYTES     64
+#define ROS_APP_LVC_NODES_PER_PKT  2
+
+#endif /* _ros_app_mission_cfg_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
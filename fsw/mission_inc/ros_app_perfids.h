@@ -29,7 +29,21 @@
 #ifndef _ros_app_perfids_h_
 #define _ros_app_perfids_h_
 
-#define ROS_APP_PERF_ID 91
+#define ROS_APP_PERF_ID      91 /* Main loop, everything between two pipe receives */
+#define ROS_APP_INST_PERF_ID 99 /* The same for the instances on child tasks */
+
+/*
+** Processing stages.  Each is also timed into a histogram, see
+** ROS_APP_STAGE_* in ros_app_msg.h.
+*/
+#define ROS_APP_DISPATCH_PERF_ID 92 /* ROS_APP_ProcessCommandPacket, includes the stages below */
+#define ROS_APP_ROSOUT_PERF_ID   93 /* Single-packet /rosout handling */
+#define ROS_APP_FRAG_PERF_ID     94 /* /rosout fragment handling and reassembly */
+#define ROS_APP_CMD_PERF_ID      95 /* Ground commands */
+#define ROS_APP_HK_PERF_ID       96 /* Housekeeping reporting */
+#define ROS_APP_TBL_PERF_ID      97 /* Table management */
+#define ROS_APP_TASKS_PERF_ID    98 /* Periodic tasks */
+#define ROS_APP_EVS_PERF_ID      100 /* cFE event forwarding */
 
 #endif /* _ros_app_perfids_h_ */
 
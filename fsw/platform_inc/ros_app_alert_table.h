@@ -0,0 +1,62 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_alert_table.h
+**
+** Purpose:
+**  Define the /rosout alert pattern table
+**
+** Notes:
+**  A pattern matches anywhere in a record's msg text, case sensitive.
+**  Entries with an empty Text are unused.
+**
+*******************************************************************************/
+#ifndef _ros_app_alert_table_h_
+#define _ros_app_alert_table_h_
+
+#include "ros_app_mission_cfg.h"
+
+/*
+** One alert pattern
+*/
+typedef struct
+{
+    char  Text[ROS_APP_ALERT_PATTERN_BYTES]; /* Phrase to look for */
+    char  Node[ROS_APP_NODE_NAME_BYTES];     /* Only records from this node, empty for any node */
+    uint8 MinSeverity;                       /* Only records at or above this ROS_APP_SEVERITY_* */
+    uint8 spare[3];
+
+} ROS_APP_AlertPattern_t;
+
+/*
+** Table structure
+*/
+typedef struct
+{
+    uint32                 EventHoldoffMs; /* Minimum time between events for the same pattern */
+    ROS_APP_AlertPattern_t Patterns[ROS_APP_ALERT_MAX_PATTERNS];
+
+} ROS_APP_AlertTable_t;
+
+#endif /* _ros_app_alert_table_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -32,9 +32,16 @@
 
 #include "cfe_msgids.h"
 
+/*
+** Every MID below belongs to instance 0.  Instance n uses the same MIDs
+** plus n times this stride, see ROS_APP_INSTANCE_COUNT.
+*/
+#define ROS_APP_INSTANCE_MID_STRIDE 0x100
+
 /* Command Message IDs */
 #define ROS_APP_CMD_MID        (CFE_PLATFORM_CMD_MID_BASE + 0x96)
 #define ROS_APP_SEND_HK_MID    (CFE_PLATFORM_CMD_MID_BASE + 0x97)
+#define ROS_APP_WAKEUP_MID     (CFE_PLATFORM_CMD_MID_BASE + 0x98)
 
 /* Telemetry Message IDs */
 #define ROS_APP_HK_TLM_MID       (CFE_PLATFORM_TLM_MID_BASE + 0x97)
@@ -43,6 +50,30 @@
 #define ROS_APP_ROSOUT_WARN_MID  (CFE_PLATFORM_TLM_MID_BASE + 0x9A)
 #define ROS_APP_ROSOUT_ERROR_MID (CFE_PLATFORM_TLM_MID_BASE + 0x9B)
 #define ROS_APP_ROSOUT_FATAL_MID (CFE_PLATFORM_TLM_MID_BASE + 0x9C)
+#define ROS_APP_REPLAY_TLM_MID   (CFE_PLATFORM_TLM_MID_BASE + 0x9D)
+#define ROS_APP_LOADGEN_TLM_MID  (CFE_PLATFORM_TLM_MID_BASE + 0x9E)
+#define ROS_APP_ROSOUT_FRAG_MID  (CFE_PLATFORM_TLM_MID_BASE + 0x9F)
+#define ROS_APP_ROSOUT_LONG_MID  (CFE_PLATFORM_TLM_MID_BASE + 0xA0)
+#define ROS_APP_ROSOUT_FWD_MID   (CFE_PLATFORM_TLM_MID_BASE + 0xA1)
+#define ROS_APP_SCHED_TLM_MID    (CFE_PLATFORM_TLM_MID_BASE + 0xA2)
+#define ROS_APP_TASKS_TLM_MID    (CFE_PLATFORM_TLM_MID_BASE + 0xA3)
+#define ROS_APP_PERF_TLM_MID     (CFE_PLATFORM_TLM_MID_BASE + 0xA4)
+#define ROS_APP_ALERT_TLM_MID    (CFE_PLATFORM_TLM_MID_BASE + 0xA5)
+#define ROS_APP_ROSOUT_TMPL_MID  (CFE_PLATFORM_TLM_MID_BASE + 0xA6)
+#define ROS_APP_TMPL_DEF_MID     (CFE_PLATFORM_TLM_MID_BASE + 0xA7)
+#define ROS_APP_TMPL_TLM_MID     (CFE_PLATFORM_TLM_MID_BASE + 0xA8)
+#define ROS_APP_EVS_BATCH_MID    (CFE_PLATFORM_TLM_MID_BASE + 0xA9)
+#define ROS_APP_EVS_FWD_TLM_MID  (CFE_PLATFORM_TLM_MID_BASE + 0xAA)
+#define ROS_APP_RECORDER_TLM_MID (CFE_PLATFORM_TLM_MID_BASE + 0xAB)
+#define ROS_APP_RECORDER_REC_MID (CFE_PLATFORM_TLM_MID_BASE + 0xAC)
+#define ROS_APP_EXPORT_TLM_MID   (CFE_PLATFORM_TLM_MID_BASE + 0xAD)
+#define ROS_APP_FLOW_CTL_MID     (CFE_PLATFORM_TLM_MID_BASE + 0xAE)
+#define ROS_APP_ROLLUP_TLM_MID   (CFE_PLATFORM_TLM_MID_BASE + 0xAF)
+#define ROS_APP_FILTER_TLM_MID   (CFE_PLATFORM_TLM_MID_BASE + 0xB0)
+#define ROS_APP_SEQ_TLM_MID      (CFE_PLATFORM_TLM_MID_BASE + 0xB1)
+#define ROS_APP_LVC_TLM_MID      (CFE_PLATFORM_TLM_MID_BASE + 0xB2)
+#define ROS_APP_LIVENESS_TLM_MID (CFE_PLATFORM_TLM_MID_BASE + 0xB3)
+#define ROS_APP_CLOCK_TLM_MID    (CFE_PLATFORM_TLM_MID_BASE + 0xB4)
 
 #endif /* _ros_app_msgids_h_ */
 
@@ -0,0 +1,209 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_platform_cfg.h
+**
+** Purpose:
+**  Define ros App platform configuration parameters
+**
+** Notes:
+**  These values size the app's internal buffers and child tasks.  Values that
+**  operators may want to change at run time live in the app table instead.
+**
+*******************************************************************************/
+#ifndef _ros_app_platform_cfg_h_
+#define _ros_app_platform_cfg_h_
+
+/*
+** Instances.  Each instance has its own pipe, tables, state and MIDs offset
+** by ROS_APP_INSTANCE_MID_STRIDE, so one ros_app can serve several robots or
+** ROS domains.  Instance 0 runs in the app's main task and keeps the
+** unsuffixed names; the others run on child tasks named
+** ROS_APP_INSTANCE_TASK_NAME<n>.  The MID stride leaves room for 8.
+*/
+#define ROS_APP_INSTANCE_COUNT      1
+#define ROS_APP_INSTANCE_TASK_NAME  "ROS_APP_INST"
+#define ROS_APP_INSTANCE_STACK_SIZE 16384
+#define ROS_APP_INSTANCE_PRIORITY   50 /* Same as the main task in the startup script */
+
+#if ROS_APP_INSTANCE_COUNT < 1 || ROS_APP_INSTANCE_COUNT > 8
+#error ROS_APP_INSTANCE_COUNT must be between 1 and 8
+#endif
+
+/*
+** Main loop.  The pipe is read with this timeout so periodic work still
+** runs when neither traffic nor ROS_APP_WAKEUP_MID arrives.
+*/
+#define ROS_APP_RECEIVE_TIMEOUT_MS 50
+
+/*
+** Record and replay
+*/
+#define ROS_APP_REPLAY_TASK_NAME       "ROS_APP_REPLAY"
+#define ROS_APP_REPLAY_STACK_SIZE      16384
+#define ROS_APP_REPLAY_PRIORITY        110   /* Keep below ros_app so the replay cannot starve it */
+#define ROS_APP_REPLAY_MAX_MSG_BYTES   1024  /* Largest SB message accepted in a capture file */
+#define ROS_APP_REPLAY_DRAIN_POLL_MS   100   /* How often the replay task checks for the pipe to drain */
+#define ROS_APP_REPLAY_DRAIN_LIMIT_MS  5000  /* Give up waiting for stragglers after this long */
+
+/*
+** Synthetic load generator
+*/
+#define ROS_APP_LOADGEN_TASK_NAME  "ROS_APP_LOADGEN"
+#define ROS_APP_LOADGEN_STACK_SIZE 16384
+#define ROS_APP_LOADGEN_PRIORITY   110 /* Keep below ros_app so the generator cannot starve it */
+#define ROS_APP_LOADGEN_SLICE_MS   10  /* Send granularity; each slice catches up to the target rate */
+#define ROS_APP_LOADGEN_SETTLE_MS  200 /* Time allowed for the pipe to drain after each step */
+#define ROS_APP_LOADGEN_FLOW_PIPE_DEPTH 4 /* Flow control advice waiting for the generator */
+
+/*
+** Reassembly of fragmented /rosout messages
+*/
+#define ROS_APP_REASM_MAX_INFLIGHT 4    /* Messages that can be partially received at once */
+#define ROS_APP_REASM_TIMEOUT_MS   2000 /* Discard a partial message this long after its first fragment */
+#define ROS_APP_REASM_EXPIRE_MS    250  /* How often partial messages are checked for timeout */
+#define ROS_APP_REASM_EXPIRE_BUDGET_USEC 100
+
+/*
+** Downlink scheduler
+*/
+#define ROS_APP_SCHED_QUEUE_BYTES          16384 /* Storage for each severity class queue */
+#define ROS_APP_SCHED_QUANTUM_BYTES        512   /* Deficit added per weight unit per round */
+#define ROS_APP_SCHED_MAX_PACKET_BYTES     1280  /* Largest packet that can be queued */
+#define ROS_APP_SCHED_DEFAULT_BYTES_PER_TICK 8192 /* Used until the table has been loaded */
+#define ROS_APP_SCHED_TICK_MS              100  /* Period of the scheduler; the budget applies per tick */
+#define ROS_APP_SCHED_TICK_BUDGET_USEC     2000
+
+/*
+** cFE event forwarding.  A partly filled batch waits at most one flush
+** period before it is sent.
+*/
+#define ROS_APP_EVS_FLUSH_MS          100
+#define ROS_APP_EVS_FLUSH_BUDGET_USEC 200
+#define ROS_APP_EVS_MSG_LIMIT         16 /* Event packets that can wait in the pipe */
+
+/*
+** Alert pattern matcher.  Every pattern character can add a state, so the
+** state limit follows from the table size and never rejects a load.  The
+** symbol limit is the number of distinct characters across all patterns,
+** plus one for everything else.
+*/
+#define ROS_APP_ALERT_MAX_STATES  (ROS_APP_ALERT_MAX_PATTERNS * (ROS_APP_ALERT_PATTERN_BYTES - 1) + 1)
+#define ROS_APP_ALERT_MAX_SYMBOLS 48
+
+/*
+** Template extraction
+*/
+#define ROS_APP_TMPL_MAX_TEMPLATES 128
+#define ROS_APP_TMPL_HASH_BUCKETS  256 /* Power of two */
+
+/*
+** Export of capture files.  The export task formats records into one
+** block while the writer task writes the other, and gives up the CPU
+** after each ROS_APP_EXPORT_SLICE_USEC of formatting.
+*/
+#define ROS_APP_EXPORT_TASK_NAME        "ROS_APP_EXPORT"
+#define ROS_APP_EXPORT_WRITER_TASK_NAME "ROS_APP_EXPWR"
+#define ROS_APP_EXPORT_STACK_SIZE       16384
+#define ROS_APP_EXPORT_PRIORITY         120  /* Below ros_app and the replay task */
+#define ROS_APP_EXPORT_BLOCK_BYTES      8192
+#define ROS_APP_EXPORT_SLICE_USEC       2000
+#define ROS_APP_EXPORT_YIELD_MS         10
+
+/*
+** Flow control advice.  Occupancy is checked every ROS_APP_FLOW_CHECK_MS
+** and the advice is repeated every ROS_APP_FLOW_REFRESH_MS.  The
+** watermarks are used until the table has been loaded.
+*/
+#define ROS_APP_FLOW_CHECK_MS            50
+#define ROS_APP_FLOW_CHECK_BUDGET_USEC   50
+#define ROS_APP_FLOW_REFRESH_MS          1000
+#define ROS_APP_FLOW_DEFAULT_HIGH_PCT    75
+#define ROS_APP_FLOW_DEFAULT_LOW_PCT     25
+#define ROS_APP_FLOW_DEFAULT_TARGET_PCT  80
+#define ROS_APP_FLOW_MIN_MSG_PER_SEC     10 /* Lowest total rate ever recommended */
+
+/*
+** Per-node severity thresholds.  The node hash keeps at least two slots
+** per table entry so probes stay short.
+*/
+#define ROS_APP_FILTER_HASH_SLOTS 32 /* Power of two */
+
+/*
+** Rollup summaries.  The node hash keeps at least two slots per node so
+** probes stay short.
+*/
+#define ROS_APP_ROLLUP_HASH_SLOTS           32 /* Power of two */
+#define ROS_APP_ROLLUP_CHECK_MS             100
+#define ROS_APP_ROLLUP_CHECK_BUDGET_USEC    200
+#define ROS_APP_ROLLUP_DEFAULT_INTERVAL_SEC 60 /* Used until the table has been loaded */
+
+/*
+** Last-value cache.  Nodes seen once the cache is full are not cached.
+*/
+#define ROS_APP_LVC_MAX_NODES  32
+#define ROS_APP_LVC_HASH_SLOTS 64 /* Power of two */
+
+/*
+** Node liveness.  Silence is measured in ticks of ROS_APP_LIVENESS_TICK_MS,
+** so it is only exact to within one tick.  Nodes seen once
+** ROS_APP_LIVENESS_MAX_NODES are tracked are not watched.
+*/
+#define ROS_APP_LIVENESS_MAX_NODES         1024
+#define ROS_APP_LIVENESS_HASH_SLOTS        2048 /* Power of two */
+#define ROS_APP_LIVENESS_TICK_MS           100
+#define ROS_APP_LIVENESS_TICK_BUDGET_USEC  500
+#define ROS_APP_LIVENESS_MAX_CATCHUP_TICKS 600 /* Ticks run per call after a stall */
+#define ROS_APP_LIVENESS_MAX_SILENCE_MS    86400000
+
+/*
+** ROS-to-cFE clock correlation.  Each ROS_APP_CLOCK_SAMPLE_MS the record
+** with the smallest cFE-minus-ROS offset becomes one sample of a window of
+** ROS_APP_CLOCK_WINDOW.  A sample further than ROS_APP_CLOCK_STEP_USEC
+** from the model is taken as a clock step and restarts the window.
+*/
+#define ROS_APP_CLOCK_SAMPLE_MS          5000
+#define ROS_APP_CLOCK_SAMPLE_BUDGET_USEC 200
+#define ROS_APP_CLOCK_WINDOW             32
+#define ROS_APP_CLOCK_MIN_SAMPLES        4 /* Before records are stamped */
+#define ROS_APP_CLOCK_STEP_USEC          1000000
+#define ROS_APP_CLOCK_MAX_DRIFT_PPB      1000000
+
+/*
+** Incoming sequence checks.  This many late packets in a row on one MID
+** are taken as a sender restart and the count is followed from there.
+*/
+#define ROS_APP_SEQ_RESYNC_PACKETS 4
+
+/*
+** Flight recorder.  Each record is its own CDS block, so the depth is
+** limited by CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES as well as CDS size.
+*/
+#define ROS_APP_RECORDER_DEPTH 16
+
+#if ROS_APP_RECORDER_DEPTH < 1 || ROS_APP_RECORDER_DEPTH > 99
+#error ROS_APP_RECORDER_DEPTH must be between 1 and 99
+#endif
+
+#endif /* _ros_app_platform_cfg_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
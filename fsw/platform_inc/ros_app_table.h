@@ -30,6 +30,52 @@
 #ifndef _ros_app_table_h_
 #define _ros_app_table_h_
 
+#include "ros_app_mission_cfg.h"
+
+/*
+** Sampling rates for one node.  Unused entries have an empty Node.
+*/
+typedef struct
+{
+    char   Node[ROS_APP_NODE_NAME_BYTES];
+    uint16 Rates[ROS_APP_SEVERITY_COUNT];
+    uint16 spare;
+
+} ROS_APP_SampleNode_t;
+
+/*
+** Lowest severity forwarded for one app's events.  Unused entries have an
+** empty App.
+*/
+typedef struct
+{
+    char  App[ROS_APP_EVS_APP_NAME_BYTES];
+    uint8 MinSeverity; /* ROS_APP_SEVERITY_*, ROS_APP_SEVERITY_COUNT forwards nothing */
+    uint8 spare[3];
+
+} ROS_APP_EvsFilter_t;
+
+/*
+** Lowest severity kept from one node.  Unused entries have an empty Node.
+*/
+typedef struct
+{
+    char  Node[ROS_APP_NODE_NAME_BYTES];
+    uint8 MinSeverity; /* ROS_APP_SEVERITY_*, ROS_APP_SEVERITY_COUNT drops everything */
+    uint8 spare[3];
+
+} ROS_APP_NodeFilter_t;
+
+/*
+** How long one node may stay silent.  Unused entries have an empty Node.
+*/
+typedef struct
+{
+    char   Node[ROS_APP_NODE_NAME_BYTES];
+    uint32 SilenceMs; /* 0 to stop watching the node */
+
+} ROS_APP_NodeSilence_t;
+
 /*
 ** Table structure
 */
@@ -38,6 +84,81 @@ typedef struct
     uint16 Int1;
     uint16 Int2;
 
+    /*
+    ** Downlink scheduler.  FATAL and ERROR are always sent first; the
+    ** remaining budget is shared between WARN, INFO and DEBUG in proportion
+    ** to their weights.  The ERROR and FATAL weights are not used.
+    */
+    uint32 DownlinkBytesPerTick;
+    uint8  DownlinkWeights[ROS_APP_SEVERITY_COUNT];
+    uint8  spare[3];
+
+    /*
+    ** Sampling.  Keep 1 in N records of each severity; 0 or 1 keeps them
+    ** all.  A node listed in SampleNodes uses its own rates instead.  The
+    ** ERROR and FATAL rates are ignored, those records are always kept.
+    */
+    uint16               SampleRates[ROS_APP_SEVERITY_COUNT];
+    uint16               spare2;
+    ROS_APP_SampleNode_t SampleNodes[ROS_APP_SAMPLE_MAX_NODES];
+
+    /*
+    ** When set, records that fit a template are forwarded as a template
+    ** reference plus parameters instead of the full text
+    */
+    uint8 TemplateForward;
+    uint8 spare3[3];
+
+    /*
+    ** Forwarding of cFE events to ROS.  Events are mapped to severities
+    ** (DEBUG, INFO, ERROR and CRITICAL to FATAL) and forwarded from
+    ** EvsMinSeverity up, or from the app's own EvsFilters entry.  At most
+    ** EvsRatePerSec events are forwarded per second with bursts of up to
+    ** EvsBurst; a rate of 0 removes the cap.
+    */
+    uint8               EvsForward;
+    uint8               EvsMinSeverity;
+    uint16              EvsBurst;
+    uint32              EvsRatePerSec;
+    ROS_APP_EvsFilter_t EvsFilters[ROS_APP_EVS_MAX_FILTERS];
+
+    /*
+    ** Flow control advice to the bridge.  CONGESTED is entered when pipe or
+    ** downlink queue occupancy reaches FlowHighPct and left when it falls
+    ** to FlowLowPct.  On entry the bridge is asked to stay under
+    ** FlowTargetPct of the rate ros_app was processing; the limit is then
+    ** tightened or relaxed by that factor at each refresh.
+    */
+    uint8 FlowHighPct;
+    uint8 FlowLowPct;
+    uint8 FlowTargetPct;
+    uint8 spare4;
+
+    /*
+    ** Length of each summary in rollup mode, 1 to 3600 seconds
+    */
+    uint16 RollupIntervalSec;
+    uint16 spare5;
+
+    /*
+    ** Per-node severity thresholds, applied before any other processing.
+    ** Records from a node listed in NodeFilters are kept from its
+    ** MinSeverity up, records from any other node from DefaultMinSeverity
+    ** up.  A node may be listed once.
+    */
+    uint8                DefaultMinSeverity;
+    uint8                spare6[3];
+    ROS_APP_NodeFilter_t NodeFilters[ROS_APP_FILTER_MAX_NODES];
+
+    /*
+    ** Node liveness.  A node listed in NodeSilence is reported once it has
+    ** sent nothing for its SilenceMs, counted from table load if it has not
+    ** been heard from yet.  Any other node is reported after
+    ** DefaultSilenceMs, or never if that is 0.  A node may be listed once.
+    */
+    uint32                DefaultSilenceMs;
+    ROS_APP_NodeSilence_t NodeSilence[ROS_APP_LIVENESS_TABLE_NODES];
+
 } ROS_APP_Table_t;
 
 #endif /* _ros_app_table_h_ */
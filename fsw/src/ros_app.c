@@ -32,13 +32,17 @@
 #include "ros_app_version.h"
 #include "ros_app.h"
 #include "ros_app_table.h"
+#include "ros_app_utils.h"
 
+#include <stddef.h>
+#include <stdio.h>
 #include <string.h>
 
 /*
 ** global data
 */
-ROS_APP_Data_t ROS_APP_Data;
+ROS_APP_Global_t ROS_APP_Global;
+ROS_APP_Data_t   ROS_APP_Data[ROS_APP_INSTANCE_COUNT];
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * *  * * * * **/
 /* ROS_APP_Main() -- Application entry point and main process loop         */
@@ -46,8 +50,9 @@ ROS_APP_Data_t ROS_APP_Data;
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * *  * * * * **/
 void ROS_APP_Main(void)
 {
-    int32            status;
-    CFE_SB_Buffer_t *SBBufPtr;
+    ROS_APP_Data_t *Data = &ROS_APP_Data[0];
+    int32           status;
+    uint32          i;
 
     /*
     ** Register the app with Executive services
@@ -64,41 +69,43 @@ void ROS_APP_Main(void)
     ** If the Initialization fails, set the RunStatus to
     ** CFE_ES_RunStatus_APP_ERROR and the App will not enter the RunLoop
     */
-    status = ROS_APP_Init();
-    if (status != CFE_SUCCESS)
+    for (i = 0; i < ROS_APP_INSTANCE_COUNT; i++)
+    {
+        ROS_APP_Data[i].Instance = (uint8)i;
+    }
+
+    status = ROS_APP_AppInit();
+    if (status == CFE_SUCCESS)
     {
-        ROS_APP_Data.RunStatus = CFE_ES_RunStatus_APP_ERROR;
+        status = ROS_APP_Init(Data);
     }
 
     /*
-    ** ros Runloop
+    ** Instance 0 runs here, the others on their own tasks
     */
-    while (CFE_ES_RunLoop(&ROS_APP_Data.RunStatus) == true)
+    for (i = 1; i < ROS_APP_INSTANCE_COUNT && status == CFE_SUCCESS; i++)
     {
-        /*
-        ** Performance Log Exit Stamp
-        */
-        CFE_ES_PerfLogExit(ROS_APP_PERF_ID);
-
-        /* Pend on receipt of command packet */
-        status = CFE_SB_ReceiveBuffer(&SBBufPtr, ROS_APP_Data.CommandPipe, CFE_SB_PEND_FOREVER);
-
-        /*
-        ** Performance Log Entry Stamp
-        */
-        CFE_ES_PerfLogEntry(ROS_APP_PERF_ID);
-
-        if (status == CFE_SUCCESS)
+        status = ROS_APP_CreateChildTask(&ROS_APP_Data[i], &ROS_APP_Data[i].TaskId, ROS_APP_INSTANCE_TASK_NAME,
+                                         ROS_APP_InstanceTask, ROS_APP_INSTANCE_STACK_SIZE,
+                                         ROS_APP_INSTANCE_PRIORITY);
+        if (status != CFE_SUCCESS)
         {
-            ROS_APP_ProcessCommandPacket(SBBufPtr);
+            CFE_ES_WriteToSysLog("ros App: Error creating instance %lu task, RC = 0x%08lX\n", (unsigned long)i,
+                                 (unsigned long)status);
         }
-        else
-        {
-            CFE_EVS_SendEvent(ROS_APP_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "ROS APP: SB Pipe Read Error, App Will Exit");
+    }
 
-            ROS_APP_Data.RunStatus = CFE_ES_RunStatus_APP_ERROR;
-        }
+    if (status != CFE_SUCCESS)
+    {
+        Data->RunStatus = CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    /*
+    ** ros Runloop
+    */
+    while (CFE_ES_RunLoop(&Data->RunStatus) == true)
+    {
+        ROS_APP_ProcessPipe(Data);
     }
 
     /*
@@ -106,74 +113,383 @@ void ROS_APP_Main(void)
     */
     CFE_ES_PerfLogExit(ROS_APP_PERF_ID);
 
-    CFE_ES_ExitApp(ROS_APP_Data.RunStatus);
+    CFE_ES_ExitApp(Data->RunStatus);
 
 } /* End of ROS_APP_Main() */
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_InstanceTask                                               */
 /*                                                                            */
-/* ROS_APP_Init() --  initialization                                       */
+/*  Purpose:                                                                  */
+/*         Child task entry point for instances other than 0.  Initializes    */
+/*         the instance and runs its pipe until the instance fails; the       */
+/*         task is deleted with the app.                                      */
 /*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_InstanceTask(void)
+{
+    ROS_APP_Data_t *Data = ROS_APP_ChildTaskData();
+
+    CFE_ES_PerfLogEntry(ROS_APP_INST_PERF_ID);
+
+    if (ROS_APP_Init(Data) != CFE_SUCCESS)
+    {
+        Data->RunStatus = CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    while (Data->RunStatus == CFE_ES_RunStatus_APP_RUN)
+    {
+        ROS_APP_ProcessPipe(Data);
+    }
+
+    CFE_ES_PerfLogExit(ROS_APP_INST_PERF_ID);
+
+    CFE_ES_WriteToSysLog("ros App: instance %u stopped\n", (unsigned int)Data->Instance);
+
+    CFE_ES_ExitChildTask();
+
+} /* End of ROS_APP_InstanceTask() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-int32 ROS_APP_Init(void)
+/*  Name:  ROS_APP_ProcessPipe                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         One pass of an instance's run loop: pend on its pipe, handle what  */
+/*         arrived and run any periodic work that has come due.               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_ProcessPipe(ROS_APP_Data_t *Data)
 {
-    int32 status;
+    int32            status;
+    CFE_SB_Buffer_t *SBBufPtr;
+    uint64           BusyStart;
+    uint64           StageStart;
+    uint64           Now;
 
-    ROS_APP_Data.RunStatus = CFE_ES_RunStatus_APP_RUN;
+    /*
+    ** Performance Log Exit Stamp
+    */
+    CFE_ES_PerfLogExit(Data->PerfId);
 
     /*
-    ** Initialize app command execution counters
+    ** Take a packet that is already waiting, counting how many in a row
+    ** were, for flow control.  Otherwise pend on receipt of command packet,
+    ** waking up in time for any periodic work that comes due while the
+    ** pipe is quiet.
     */
-    ROS_APP_Data.CmdCounter = 0;
-    ROS_APP_Data.ErrCounter = 0;
+    status = CFE_SB_ReceiveBuffer(&SBBufPtr, Data->CommandPipe, CFE_SB_POLL);
+    if (status == CFE_SB_NO_MESSAGE)
+    {
+        Data->Flow.Backlog = 0;
+
+        status = CFE_SB_ReceiveBuffer(&SBBufPtr, Data->CommandPipe, ROS_APP_RECEIVE_TIMEOUT_MS);
+    }
+    else if (status == CFE_SUCCESS && Data->Flow.Backlog < Data->PipeDepth)
+    {
+        Data->Flow.Backlog++;
+    }
 
     /*
-    ** Initialize app configuration data
+    ** Performance Log Entry Stamp
+    */
+    CFE_ES_PerfLogEntry(Data->PerfId);
+
+    BusyStart = ROS_APP_GetTimeUsec();
+
+    if (status == CFE_SUCCESS)
+    {
+        ROS_APP_ProcessCommandPacket(Data, SBBufPtr);
+    }
+    else if (status == CFE_SB_TIME_OUT)
+    {
+        Data->Tasks.Tlm.Payload.Timeouts++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(ROS_APP_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ROS APP: SB Pipe Read Error, instance %u Will Exit", (unsigned int)Data->Instance);
+
+        Data->RunStatus = CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    /*
+    ** Periodic work runs here whether it was a wakeup, a timeout or
+    ** traffic that brought us out of the receive
     */
-    ROS_APP_Data.PipeDepth = ROS_APP_PIPE_DEPTH;
+    Now = ROS_APP_GetTimeUsec();
+    if (Now >= Data->Tasks.NextDueUsec)
+    {
+        CFE_ES_PerfLogEntry(ROS_APP_TASKS_PERF_ID);
+        StageStart = ROS_APP_Perf_Start();
+
+        ROS_APP_Tasks_RunDue(&Data->Tasks, Now);
+
+        ROS_APP_Perf_Stop(&Data->Perf, ROS_APP_STAGE_TASKS, StageStart);
+        CFE_ES_PerfLogExit(ROS_APP_TASKS_PERF_ID);
+    }
+
+    Data->BusyUsec += ROS_APP_GetTimeUsec() - BusyStart;
+
+} /* End of ROS_APP_ProcessPipe() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_CreateChildTask                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Creates a child task working on one instance.  The task name gets  */
+/*         the instance number past instance 0.  Returns once the task has    */
+/*         picked up its instance with ROS_APP_ChildTaskData.                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32 ROS_APP_CreateChildTask(ROS_APP_Data_t *Data, CFE_ES_TaskId_t *TaskId, const char *BaseName,
+                              CFE_ES_ChildTaskMainFuncPtr_t Func, size_t StackSize,
+                              CFE_ES_TaskPriority_Atom_t Priority)
+{
+    char  TaskName[OS_MAX_API_NAME];
+    int32 status;
+
+    ROS_APP_InstanceName(TaskName, sizeof(TaskName), BaseName, Data->Instance);
+
+    OS_MutSemTake(ROS_APP_Global.StartMutex);
+
+    ROS_APP_Global.Starting = Data;
+
+    status = CFE_ES_CreateChildTask(TaskId, TaskName, Func, CFE_ES_TASK_STACK_ALLOCATE, StackSize, Priority, 0);
+    if (status == CFE_SUCCESS)
+    {
+        OS_BinSemTake(ROS_APP_Global.StartSem);
+    }
+
+    ROS_APP_Global.Starting = NULL;
+
+    OS_MutSemGive(ROS_APP_Global.StartMutex);
+
+    return status;
+
+} /* End of ROS_APP_CreateChildTask() */
 
-    strncpy(ROS_APP_Data.PipeName, "ROS_APP_CMD_PIPE", sizeof(ROS_APP_Data.PipeName));
-    ROS_APP_Data.PipeName[sizeof(ROS_APP_Data.PipeName) - 1] = 0;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_ChildTaskData                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Called first thing by every child task to get the instance it was  */
+/*         created for.                                                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+ROS_APP_Data_t *ROS_APP_ChildTaskData(void)
+{
+    ROS_APP_Data_t *Data = ROS_APP_Global.Starting;
+
+    OS_BinSemGive(ROS_APP_Global.StartSem);
+
+    return Data;
+
+} /* End of ROS_APP_ChildTaskData() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  */
+/*                                                                            */
+/* ROS_APP_AppInit() --  initialization shared by all instances              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_AppInit(void)
+{
+    int32 status;
 
     /*
     ** Initialize event filter table...
     */
-    ROS_APP_Data.EventFilters[0].EventID = ROS_APP_STARTUP_INF_EID;
-    ROS_APP_Data.EventFilters[0].Mask    = 0x0000;
-    ROS_APP_Data.EventFilters[1].EventID = ROS_APP_COMMAND_ERR_EID;
-    ROS_APP_Data.EventFilters[1].Mask    = 0x0000;
-    ROS_APP_Data.EventFilters[2].EventID = ROS_APP_COMMANDNOP_INF_EID;
-    ROS_APP_Data.EventFilters[2].Mask    = 0x0000;
-    ROS_APP_Data.EventFilters[3].EventID = ROS_APP_COMMANDRST_INF_EID;
-    ROS_APP_Data.EventFilters[3].Mask    = 0x0000;
-    ROS_APP_Data.EventFilters[4].EventID = ROS_APP_INVALID_MSGID_ERR_EID;
-    ROS_APP_Data.EventFilters[4].Mask    = 0x0000;
-    ROS_APP_Data.EventFilters[5].EventID = ROS_APP_LEN_ERR_EID;
-    ROS_APP_Data.EventFilters[5].Mask    = 0x0000;
-    ROS_APP_Data.EventFilters[6].EventID = ROS_APP_PIPE_ERR_EID;
-    ROS_APP_Data.EventFilters[6].Mask    = 0x0000;
-    ROS_APP_Data.EventFilters[7].EventID = ROS_APP_HELLO_WORLD_INF_EID;
-    ROS_APP_Data.EventFilters[7].Mask    = 0x0000;
+    ROS_APP_Global.EventFilters[0].EventID = ROS_APP_STARTUP_INF_EID;
+    ROS_APP_Global.EventFilters[0].Mask    = 0x0000;
+    ROS_APP_Global.EventFilters[1].EventID = ROS_APP_COMMAND_ERR_EID;
+    ROS_APP_Global.EventFilters[1].Mask    = 0x0000;
+    ROS_APP_Global.EventFilters[2].EventID = ROS_APP_COMMANDNOP_INF_EID;
+    ROS_APP_Global.EventFilters[2].Mask    = 0x0000;
+    ROS_APP_Global.EventFilters[3].EventID = ROS_APP_COMMANDRST_INF_EID;
+    ROS_APP_Global.EventFilters[3].Mask    = 0x0000;
+    ROS_APP_Global.EventFilters[4].EventID = ROS_APP_INVALID_MSGID_ERR_EID;
+    ROS_APP_Global.EventFilters[4].Mask    = 0x0000;
+    ROS_APP_Global.EventFilters[5].EventID = ROS_APP_LEN_ERR_EID;
+    ROS_APP_Global.EventFilters[5].Mask    = 0x0000;
+    ROS_APP_Global.EventFilters[6].EventID = ROS_APP_PIPE_ERR_EID;
+    ROS_APP_Global.EventFilters[6].Mask    = 0x0000;
+    ROS_APP_Global.EventFilters[7].EventID = ROS_APP_HELLO_WORLD_INF_EID;
+    ROS_APP_Global.EventFilters[7].Mask    = 0x0000;
 
     /*
     ** Register the events
     */
-    status = CFE_EVS_Register(ROS_APP_Data.EventFilters, ROS_APP_EVENT_COUNTS, CFE_EVS_EventFilter_BINARY);
+    status = CFE_EVS_Register(ROS_APP_Global.EventFilters, ROS_APP_EVENT_COUNTS, CFE_EVS_EventFilter_BINARY);
     if (status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("ros App: Error Registering Events, RC = 0x%08lX\n", (unsigned long)status);
         return (status);
     }
 
+    /*
+    ** Child task start handshake
+    */
+    status = OS_MutSemCreate(&ROS_APP_Global.StartMutex, "ROS_APP_START_MTX", 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("ros App: Error creating start mutex, RC = %ld\n", (long)status);
+        return (status);
+    }
+
+    status = OS_BinSemCreate(&ROS_APP_Global.StartSem, "ROS_APP_START_SEM", 0, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("ros App: Error creating start semaphore, RC = %ld\n", (long)status);
+        return (status);
+    }
+
+    return (CFE_SUCCESS);
+
+} /* End of ROS_APP_AppInit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  */
+/*                                                                            */
+/* ROS_APP_RegisterTable() --  register and load one of an instance's tables */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static int32 ROS_APP_RegisterTable(ROS_APP_Data_t *Data, uint32 Idx, const char *BaseName, size_t Size,
+                                   CFE_TBL_CallbackFuncPtr_t ValidationFunc, const char *BaseFile)
+{
+    char  TblFile[OS_MAX_PATH_LEN];
+    void *DefaultPtr;
+    int32 status;
+
+    ROS_APP_InstanceName(Data->TblNames[Idx], sizeof(Data->TblNames[Idx]), BaseName, Data->Instance);
+
+    status = CFE_TBL_Register(&Data->TblHandles[Idx], Data->TblNames[Idx], Size, CFE_TBL_OPT_DEFAULT,
+                              ValidationFunc);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("Ros App: Error Registering Table %s, RC = 0x%08lX\n", Data->TblNames[Idx],
+                             (unsigned long)status);
+
+        return (status);
+    }
+
+    ROS_APP_InstanceName(TblFile, sizeof(TblFile), BaseFile, Data->Instance);
+
+    status = CFE_TBL_Load(Data->TblHandles[Idx], CFE_TBL_SRC_FILE, TblFile);
+
+    /*
+    ** Instances without a file of their own start from instance 0's table
+    */
+    if (status != CFE_SUCCESS && Data->Instance != 0 &&
+        CFE_TBL_GetAddress(&DefaultPtr, ROS_APP_Data[0].TblHandles[Idx]) >= CFE_SUCCESS)
+    {
+        CFE_TBL_Load(Data->TblHandles[Idx], CFE_TBL_SRC_ADDRESS, DefaultPtr);
+        CFE_TBL_ReleaseAddress(ROS_APP_Data[0].TblHandles[Idx]);
+    }
+
+    return (CFE_SUCCESS);
+
+} /* End of ROS_APP_RegisterTable() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  */
+/*                                                                            */
+/* ROS_APP_Init() --  initialization of one instance                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_Init(ROS_APP_Data_t *Data)
+{
+    int32 status;
+
+    Data->RunStatus = CFE_ES_RunStatus_APP_RUN;
+
+    Data->MidOffset = Data->Instance * ROS_APP_INSTANCE_MID_STRIDE;
+    Data->PerfId    = (Data->Instance == 0) ? ROS_APP_PERF_ID : ROS_APP_INST_PERF_ID;
+
+    /*
+    ** Initialize app command execution counters
+    */
+    Data->CmdCounter = 0;
+    Data->ErrCounter = 0;
+
+    Data->RosoutMsgCount = 0;
+    Data->RosoutRejected = 0;
+    Data->RosoutRepaired = 0;
+    Data->BusyUsec       = 0;
+
+    /*
+    ** Initialize app configuration data
+    */
+    Data->PipeDepth = ROS_APP_PIPE_DEPTH;
+
+    ROS_APP_InstanceName(Data->PipeName, sizeof(Data->PipeName), "ROS_APP_CMD_PIPE", Data->Instance);
+
     /*
     ** Initialize housekeeping packet (clear user data area).
     */
-    CFE_MSG_Init(&ROS_APP_Data.HkTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_HK_TLM_MID), sizeof(ROS_APP_Data.HkTlm));
+    CFE_MSG_Init(&Data->HkTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_HK_TLM_MID + Data->MidOffset),
+                 sizeof(Data->HkTlm));
+    Data->HkTlm.Payload.Instance = Data->Instance;
+
+    ROS_APP_Reasm_Init(&Data->Reasm, Data->MidOffset);
+    ROS_APP_Seq_Init(&Data->Seq, Data->MidOffset);
+    ROS_APP_Lvc_Init(&Data->Lvc, Data->MidOffset);
+    ROS_APP_Liveness_Init(&Data->Liveness, Data->MidOffset);
+    ROS_APP_Clock_Init(&Data->Clock, Data->MidOffset);
+    ROS_APP_Sched_Init(&Data->Sched, Data->MidOffset, &Data->Seq);
+    ROS_APP_Flow_Init(&Data->Flow, Data->MidOffset, Data->PipeDepth);
+    ROS_APP_Rollup_Init(&Data->Rollup, Data->MidOffset);
+    ROS_APP_Filter_Init(&Data->Filter, Data->MidOffset);
+    CFE_MSG_Init(&Data->FwdTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_FWD_MID + Data->MidOffset),
+                 sizeof(Data->FwdTlm));
+    ROS_APP_Replay_Init(&Data->Replay, Data->MidOffset);
+    ROS_APP_LoadGen_Init(&Data->LoadGen, Data->MidOffset);
+    ROS_APP_Export_Init(&Data->Export, Data->MidOffset);
+    ROS_APP_Alert_Init(&Data->Alert, Data->MidOffset);
+    ROS_APP_Sample_Init(&Data->Sample);
+    ROS_APP_Tmpl_Init(&Data->Tmpl, Data->MidOffset);
+    ROS_APP_EvsFwd_Init(&Data->EvsFwd, Data->MidOffset);
+    CFE_MSG_Init(&Data->TmplFwdTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_TMPL_MID + Data->MidOffset),
+                 sizeof(Data->TmplFwdTlm));
+    CFE_MSG_Init(&Data->TmplDefTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_TMPL_DEF_MID + Data->MidOffset),
+                 sizeof(Data->TmplDefTlm));
+
+    /*
+    ** Recover the flight recorder, and the counters it saved, after a reset
+    */
+    ROS_APP_Recorder_Init(&Data->Recorder, Data->Instance, Data->MidOffset);
+    if (Data->Recorder.Restored)
+    {
+        Data->CmdCounter     = Data->Recorder.Hdr.Counters.CmdCounter;
+        Data->ErrCounter     = Data->Recorder.Hdr.Counters.ErrCounter;
+        Data->RosoutMsgCount = Data->Recorder.Hdr.Counters.RosoutMsgCount;
+
+        CFE_EVS_SendEvent(ROS_APP_RECORDER_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "ros: flight recorder restored, %u records, %lu ERROR %lu FATAL since power-on",
+                          (unsigned int)ROS_APP_Recorder_Count(&Data->Recorder),
+                          (unsigned long)Data->Recorder.Hdr.ErrorCount, (unsigned long)Data->Recorder.Hdr.FatalCount);
+    }
+
+    /*
+    ** Register periodic work
+    */
+    ROS_APP_Perf_Init(&Data->Perf, Data->MidOffset);
+    ROS_APP_Tasks_Init(&Data->Tasks, Data->MidOffset);
+    ROS_APP_Tasks_Register(&Data->Tasks, "SCHED", ROS_APP_SchedTickTask, &Data->Sched,
+                           ROS_APP_SCHED_TICK_MS, ROS_APP_SCHED_TICK_BUDGET_USEC);
+    ROS_APP_Tasks_Register(&Data->Tasks, "REASM", ROS_APP_ReasmExpireTask, &Data->Reasm,
+                           ROS_APP_REASM_EXPIRE_MS, ROS_APP_REASM_EXPIRE_BUDGET_USEC);
+    ROS_APP_Tasks_Register(&Data->Tasks, "EVSFWD", ROS_APP_EvsFlushTask, &Data->EvsFwd, ROS_APP_EVS_FLUSH_MS,
+                           ROS_APP_EVS_FLUSH_BUDGET_USEC);
+    ROS_APP_Tasks_Register(&Data->Tasks, "FLOW", ROS_APP_FlowCheckTask, Data, ROS_APP_FLOW_CHECK_MS,
+                           ROS_APP_FLOW_CHECK_BUDGET_USEC);
+    ROS_APP_Tasks_Register(&Data->Tasks, "ROLLUP", ROS_APP_RollupTask, Data, ROS_APP_ROLLUP_CHECK_MS,
+                           ROS_APP_ROLLUP_CHECK_BUDGET_USEC);
+    ROS_APP_Tasks_Register(&Data->Tasks, "LIVENESS", ROS_APP_LivenessTask, &Data->Liveness,
+                           ROS_APP_LIVENESS_TICK_MS, ROS_APP_LIVENESS_TICK_BUDGET_USEC);
+    ROS_APP_Tasks_Register(&Data->Tasks, "CLOCK", ROS_APP_ClockSampleTask, &Data->Clock, ROS_APP_CLOCK_SAMPLE_MS,
+                           ROS_APP_CLOCK_SAMPLE_BUDGET_USEC);
 
     /*
     ** Create Software Bus message pipe.
     */
-    status = CFE_SB_CreatePipe(&ROS_APP_Data.CommandPipe, ROS_APP_Data.PipeDepth, ROS_APP_Data.PipeName);
+    status = CFE_SB_CreatePipe(&Data->CommandPipe, Data->PipeDepth, Data->PipeName);
     if (status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("ros App: Error creating pipe, RC = 0x%08lX\n", (unsigned long)status);
@@ -183,17 +499,27 @@ int32 ROS_APP_Init(void)
     /*
     ** Subscribe to Housekeeping request commands
     */
-    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_SEND_HK_MID), ROS_APP_Data.CommandPipe);
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_SEND_HK_MID + Data->MidOffset), Data->CommandPipe);
     if (status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("ros App: Error Subscribing to HK request, RC = 0x%08lX\n", (unsigned long)status);
         return (status);
     }
 
+    /*
+    ** Subscribe to scheduler wakeups
+    */
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_WAKEUP_MID + Data->MidOffset), Data->CommandPipe);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("ros App: Error Subscribing to wakeup, RC = 0x%08lX\n", (unsigned long)status);
+        return (status);
+    }
+
     /*
     ** Subscribe to ground command packets
     */
-    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_CMD_MID), ROS_APP_Data.CommandPipe);
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_CMD_MID + Data->MidOffset), Data->CommandPipe);
     if (status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("ros App: Error Subscribing to Command, RC = 0x%08lX\n", (unsigned long)status);
@@ -204,7 +530,15 @@ int32 ROS_APP_Init(void)
     /*
     ** Subscribe to the /rosout telemetry packets.
     */
-    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_INFO_MID), ROS_APP_Data.CommandPipe);
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_DEBUG_MID + Data->MidOffset), Data->CommandPipe);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("ros App: Error Subscribing to /rosout DEBUG topic, RC = 0x%08lX\n", (unsigned long)status);
+
+        return (status);
+    }
+
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_INFO_MID + Data->MidOffset), Data->CommandPipe);
     if (status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("ros App: Error Subscribing to /rosout INFO topic, RC = 0x%08lX\n", (unsigned long)status);
@@ -212,7 +546,7 @@ int32 ROS_APP_Init(void)
         return (status);
     }
 
-    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_ERROR_MID), ROS_APP_Data.CommandPipe);
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_ERROR_MID + Data->MidOffset), Data->CommandPipe);
     if (status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("ros App: Error Subscribing to /rosout ERROR topic, RC = 0x%08lX\n", (unsigned long)status);
@@ -220,7 +554,7 @@ int32 ROS_APP_Init(void)
         return (status);
     }
 
-    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_FATAL_MID), ROS_APP_Data.CommandPipe);
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_FATAL_MID + Data->MidOffset), Data->CommandPipe);
     if (status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("ros App: Error Subscribing to /rosout FATAL topic, RC = 0x%08lX\n", (unsigned long)status);
@@ -228,7 +562,7 @@ int32 ROS_APP_Init(void)
         return (status);
     }
 
-    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_WARN_MID), ROS_APP_Data.CommandPipe);
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_WARN_MID + Data->MidOffset), Data->CommandPipe);
     if (status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("ros App: Error Subscribing to /rosout WARN topic, RC = 0x%08lX\n", (unsigned long)status);
@@ -236,25 +570,37 @@ int32 ROS_APP_Init(void)
         return (status);
     }
 
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_FRAG_MID + Data->MidOffset), Data->CommandPipe);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("ros App: Error Subscribing to /rosout fragments, RC = 0x%08lX\n", (unsigned long)status);
+
+        return (status);
+    }
+
 
     /*
     ** Register Table(s)
     */
-    status = CFE_TBL_Register(&ROS_APP_Data.TblHandles[0], "RosAppTable", sizeof(ROS_APP_Table_t),
-                              CFE_TBL_OPT_DEFAULT, ROS_APP_TblValidationFunc);
+    status = ROS_APP_RegisterTable(Data, ROS_APP_TBL_IDX, ROS_APP_TABLE_NAME, sizeof(ROS_APP_Table_t),
+                                   ROS_APP_TblValidationFunc, ROS_APP_TABLE_FILE);
     if (status != CFE_SUCCESS)
     {
-        CFE_ES_WriteToSysLog("Ros App: Error Registering Table, RC = 0x%08lX\n", (unsigned long)status);
-
         return (status);
     }
-    else
+
+    status = ROS_APP_RegisterTable(Data, ROS_APP_ALERT_TBL_IDX, ROS_APP_ALERT_TABLE_NAME,
+                                   sizeof(ROS_APP_AlertTable_t), ROS_APP_AlertTblValidationFunc,
+                                   ROS_APP_ALERT_TABLE_FILE);
+    if (status != CFE_SUCCESS)
     {
-        status = CFE_TBL_Load(ROS_APP_Data.TblHandles[0], CFE_TBL_SRC_FILE, ROS_APP_TABLE_FILE);
+        return (status);
     }
 
-    CFE_EVS_SendEvent(ROS_APP_STARTUP_INF_EID, CFE_EVS_EventType_INFORMATION, "ros App Initialized.%s",
-                      ROS_APP_VERSION_STRING);
+    ROS_APP_UpdateTableConfig(Data);
+
+    CFE_EVS_SendEvent(ROS_APP_STARTUP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "ros App instance %u Initialized.%s", (unsigned int)Data->Instance, ROS_APP_VERSION_STRING);
 
     return (CFE_SUCCESS);
 
@@ -268,33 +614,89 @@ int32 ROS_APP_Init(void)
 /*     command pipe.                                                          */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
-void ROS_APP_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr)
+void ROS_APP_ProcessCommandPacket(ROS_APP_Data_t *Data, CFE_SB_Buffer_t *SBBufPtr)
 {
     CFE_SB_MsgId_t MsgId = CFE_SB_INVALID_MSG_ID;
+    uint32         MidValue;
+    uint64         DispatchStart;
+    uint64         StageStart;
+
+    CFE_ES_PerfLogEntry(ROS_APP_DISPATCH_PERF_ID);
+    DispatchStart = ROS_APP_Perf_Start();
 
     CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
 
-    switch (CFE_SB_MsgIdToValue(MsgId))
+    /*
+    ** Only this instance's MIDs reach its pipe, plus the cFE events that
+    ** all instances share
+    */
+    MidValue = CFE_SB_MsgIdToValue(MsgId);
+    if (MidValue != CFE_EVS_LONG_EVENT_MSG_MID)
+    {
+        MidValue -= Data->MidOffset;
+    }
+
+    switch (MidValue)
     {
         case ROS_APP_CMD_MID:
-            ROS_APP_ProcessGroundCommand(SBBufPtr);
+            CFE_ES_PerfLogEntry(ROS_APP_CMD_PERF_ID);
+            StageStart = ROS_APP_Perf_Start();
+
+            ROS_APP_ProcessGroundCommand(Data, SBBufPtr);
+
+            ROS_APP_Perf_Stop(&Data->Perf, ROS_APP_STAGE_CMD, StageStart);
+            CFE_ES_PerfLogExit(ROS_APP_CMD_PERF_ID);
             break;
 
         case ROS_APP_SEND_HK_MID:
-            ROS_APP_ReportHousekeeping((CFE_MSG_CommandHeader_t *)SBBufPtr);
+            CFE_ES_PerfLogEntry(ROS_APP_HK_PERF_ID);
+            StageStart = ROS_APP_Perf_Start();
+
+            ROS_APP_ReportHousekeeping(Data, (CFE_MSG_CommandHeader_t *)SBBufPtr);
+
+            ROS_APP_Perf_Stop(&Data->Perf, ROS_APP_STAGE_HK, StageStart);
+            CFE_ES_PerfLogExit(ROS_APP_HK_PERF_ID);
             break;
 
-        case ROS_APP_ROSOUT_INFO_MID:
-            ROS_APP_ReportRosoutMsg((ROS_APP_RosoutTlm_t *) SBBufPtr);
+        case ROS_APP_WAKEUP_MID:
+            /* The main loop runs whatever periodic work is due */
+            Data->Tasks.Tlm.Payload.Wakeups++;
             break;
+
+        case ROS_APP_ROSOUT_DEBUG_MID:
+        case ROS_APP_ROSOUT_INFO_MID:
         case ROS_APP_ROSOUT_WARN_MID:
-            ROS_APP_ReportRosoutMsg((ROS_APP_RosoutTlm_t *) SBBufPtr);
-            break;
         case ROS_APP_ROSOUT_ERROR_MID:
-            ROS_APP_ReportRosoutMsg((ROS_APP_RosoutTlm_t *) SBBufPtr);
-            break;
         case ROS_APP_ROSOUT_FATAL_MID:
-            ROS_APP_ReportRosoutMsg((ROS_APP_RosoutTlm_t *) SBBufPtr);
+            CFE_ES_PerfLogEntry(ROS_APP_ROSOUT_PERF_ID);
+            StageStart = ROS_APP_Perf_Start();
+
+            ROS_APP_Seq_Check(&Data->Seq, MidValue - ROS_APP_ROSOUT_DEBUG_MID, &SBBufPtr->Msg);
+            ROS_APP_ReportRosoutMsg(Data, (ROS_APP_RosoutTlm_t *) SBBufPtr);
+
+            ROS_APP_Perf_Stop(&Data->Perf, ROS_APP_STAGE_ROSOUT, StageStart);
+            CFE_ES_PerfLogExit(ROS_APP_ROSOUT_PERF_ID);
+            break;
+
+        case ROS_APP_ROSOUT_FRAG_MID:
+            CFE_ES_PerfLogEntry(ROS_APP_FRAG_PERF_ID);
+            StageStart = ROS_APP_Perf_Start();
+
+            ROS_APP_Seq_Check(&Data->Seq, ROS_APP_SEQ_STREAM_FRAG, &SBBufPtr->Msg);
+            ROS_APP_ReportRosoutFrag(Data, (ROS_APP_RosoutFragTlm_t *) SBBufPtr);
+
+            ROS_APP_Perf_Stop(&Data->Perf, ROS_APP_STAGE_FRAG, StageStart);
+            CFE_ES_PerfLogExit(ROS_APP_FRAG_PERF_ID);
+            break;
+
+        case CFE_EVS_LONG_EVENT_MSG_MID:
+            CFE_ES_PerfLogEntry(ROS_APP_EVS_PERF_ID);
+            StageStart = ROS_APP_Perf_Start();
+
+            ROS_APP_EvsFwd_Process(&Data->EvsFwd, (const CFE_EVS_LongEventTlm_t *)SBBufPtr);
+
+            ROS_APP_Perf_Stop(&Data->Perf, ROS_APP_STAGE_EVS, StageStart);
+            CFE_ES_PerfLogExit(ROS_APP_EVS_PERF_ID);
             break;
 
         default:
@@ -303,6 +705,9 @@ void ROS_APP_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr)
             break;
     }
 
+    ROS_APP_Perf_Stop(&Data->Perf, ROS_APP_STAGE_DISPATCH, DispatchStart);
+    CFE_ES_PerfLogExit(ROS_APP_DISPATCH_PERF_ID);
+
     return;
 
 } /* End ROS_APP_ProcessCommandPacket */
@@ -312,7 +717,7 @@ void ROS_APP_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr)
 /* ROS_APP_ProcessGroundCommand() -- ros ground commands                */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-void ROS_APP_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr)
+void ROS_APP_ProcessGroundCommand(ROS_APP_Data_t *Data, CFE_SB_Buffer_t *SBBufPtr)
 {
     CFE_MSG_FcnCode_t CommandCode = 0;
 
@@ -324,81 +729,231 @@ void ROS_APP_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr)
     switch (CommandCode)
     {
         case ROS_APP_NOOP_CC:
-            if (ROS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(ROS_APP_NoopCmd_t)))
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_NoopCmd_t)))
             {
-                ROS_APP_Noop((ROS_APP_NoopCmd_t *)SBBufPtr);
+                ROS_APP_Noop(Data, (ROS_APP_NoopCmd_t *)SBBufPtr);
             }
 
             break;
 
         case ROS_APP_RESET_COUNTERS_CC:
-            if (ROS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(ROS_APP_ResetCountersCmd_t)))
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_ResetCountersCmd_t)))
             {
-                ROS_APP_ResetCounters((ROS_APP_ResetCountersCmd_t *)SBBufPtr);
+                ROS_APP_ResetCounters(Data, (ROS_APP_ResetCountersCmd_t *)SBBufPtr);
             }
 
             break;
 
         case ROS_APP_PROCESS_CC:
-            if (ROS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(ROS_APP_ProcessCmd_t)))
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_ProcessCmd_t)))
             {
-                ROS_APP_Process((ROS_APP_ProcessCmd_t *)SBBufPtr);
+                ROS_APP_Process(Data, (ROS_APP_ProcessCmd_t *)SBBufPtr);
             }
 
             break;
 
         case ROS_APP_HELLO_WORLD_CC:
-            if (ROS_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(ROS_APP_ResetCountersCmd_t)))
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_ResetCountersCmd_t)))
             {
-                ROS_APP_HelloCmd((ROS_APP_NoopCmd_t *)SBBufPtr);
+                ROS_APP_HelloCmd(Data, (ROS_APP_NoopCmd_t *)SBBufPtr);
             }
 
             break;
 
-        /* default case already found during FC vs length test */
-        default:
-            CFE_EVS_SendEvent(ROS_APP_COMMAND_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Invalid ground command code: CC = %d", CommandCode);
-            break;
-    }
+        case ROS_APP_START_CAPTURE_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_StartCaptureCmd_t)))
+            {
+                ROS_APP_StartCapture(Data, (ROS_APP_StartCaptureCmd_t *)SBBufPtr);
+            }
 
-    return;
+            break;
 
-} /* End of ROS_APP_ProcessGroundCommand() */
+        case ROS_APP_STOP_CAPTURE_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_StopCaptureCmd_t)))
+            {
+                ROS_APP_StopCapture(Data, (ROS_APP_StopCaptureCmd_t *)SBBufPtr);
+            }
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-/*  Name:  ROS_APP_ReportHousekeeping                                          */
-/*                                                                            */
-/*  Purpose:                                                                  */
-/*         This function is triggered in response to a task telemetry request */
-/*         from the housekeeping task. This function will gather the Apps     */
-/*         telemetry, packetize it and send it to the housekeeping task via   */
-/*         the software bus                                                   */
-/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
-int32 ROS_APP_ReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg)
-{
-  int i;
-  
-    /*
-    ** Get command execution counters...
-    */
-    ROS_APP_Data.HkTlm.Payload.CommandErrorCounter = ROS_APP_Data.ErrCounter;
-    ROS_APP_Data.HkTlm.Payload.CommandCounter      = ROS_APP_Data.CmdCounter;
+            break;
+
+        case ROS_APP_START_REPLAY_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_StartReplayCmd_t)))
+            {
+                ROS_APP_StartReplay(Data, (ROS_APP_StartReplayCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case ROS_APP_STOP_REPLAY_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_StopReplayCmd_t)))
+            {
+                ROS_APP_StopReplay(Data, (ROS_APP_StopReplayCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case ROS_APP_START_LOADGEN_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_StartLoadGenCmd_t)))
+            {
+                ROS_APP_StartLoadGen(Data, (ROS_APP_StartLoadGenCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case ROS_APP_STOP_LOADGEN_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_StopLoadGenCmd_t)))
+            {
+                ROS_APP_StopLoadGen(Data, (ROS_APP_StopLoadGenCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case ROS_APP_SEND_PERF_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_SendPerfCmd_t)))
+            {
+                ROS_APP_SendPerf(Data, (ROS_APP_SendPerfCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case ROS_APP_RESET_PERF_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_ResetPerfCmd_t)))
+            {
+                ROS_APP_ResetPerf(Data, (ROS_APP_ResetPerfCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case ROS_APP_DUMP_RECORDER_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_DumpRecorderCmd_t)))
+            {
+                ROS_APP_DumpRecorder(Data, (ROS_APP_DumpRecorderCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case ROS_APP_START_EXPORT_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_StartExportCmd_t)))
+            {
+                ROS_APP_StartExport(Data, (ROS_APP_StartExportCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case ROS_APP_STOP_EXPORT_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_StopExportCmd_t)))
+            {
+                ROS_APP_StopExport(Data, (ROS_APP_StopExportCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case ROS_APP_SET_ROLLUP_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_SetRollupCmd_t)))
+            {
+                ROS_APP_SetRollup(Data, (ROS_APP_SetRollupCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        case ROS_APP_DUMP_LVC_CC:
+            if (ROS_APP_VerifyCmdLength(Data, &SBBufPtr->Msg, sizeof(ROS_APP_DumpLvcCmd_t)))
+            {
+                ROS_APP_DumpLvc(Data, (ROS_APP_DumpLvcCmd_t *)SBBufPtr);
+            }
+
+            break;
+
+        /* default case already found during FC vs length test */
+        default:
+            CFE_EVS_SendEvent(ROS_APP_COMMAND_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid ground command code: CC = %d", CommandCode);
+            break;
+    }
+
+    return;
+
+} /* End of ROS_APP_ProcessGroundCommand() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_ReportHousekeeping                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         This function is triggered in response to a task telemetry request */
+/*         from the housekeeping task. This function will gather the Apps     */
+/*         telemetry, packetize it and send it to the housekeeping task via   */
+/*         the software bus                                                   */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32 ROS_APP_ReportHousekeeping(ROS_APP_Data_t *Data, const CFE_MSG_CommandHeader_t *Msg)
+{
+  int i;
+  uint64 StageStart;
+  ROS_APP_RecorderCounters_t Counters;
+  
+    /*
+    ** Get command execution counters...
+    */
+    Data->HkTlm.Payload.CommandErrorCounter = Data->ErrCounter;
+    Data->HkTlm.Payload.CommandCounter      = Data->CmdCounter;
+    Data->HkTlm.Payload.RosoutMsgCount      = Data->RosoutMsgCount;
+    Data->HkTlm.Payload.ReasmCompleted      = Data->Reasm.Completed;
+    Data->HkTlm.Payload.ReasmTimeouts       = Data->Reasm.TimedOut;
+    Data->HkTlm.Payload.ReasmEvictions      = Data->Reasm.Evicted;
+    Data->HkTlm.Payload.ReasmRejected       = Data->Reasm.Rejected;
+    memcpy(Data->HkTlm.Payload.SampledOut, Data->Sample.SampledOut,
+           sizeof(Data->HkTlm.Payload.SampledOut));
+    Data->HkTlm.Payload.RosoutRejected      = Data->RosoutRejected;
+    Data->HkTlm.Payload.RosoutRepaired      = Data->RosoutRepaired;
+    Data->HkTlm.Payload.RollupMode          = Data->Rollup.Enabled ? ROS_APP_ROLLUP_ON : ROS_APP_ROLLUP_OFF;
 
     /*
     ** Send housekeeping telemetry packet...
     */
-    CFE_SB_TimeStampMsg(&ROS_APP_Data.HkTlm.TlmHeader.Msg);
-    CFE_SB_TransmitMsg(&ROS_APP_Data.HkTlm.TlmHeader.Msg, true);
+    CFE_SB_TimeStampMsg(&Data->HkTlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Data->HkTlm.TlmHeader.Msg, true);
+
+    /*
+    ** Send capture/replay progress...
+    */
+    ROS_APP_Replay_BuildTlm(&Data->Replay, &Data->Replay.Tlm.Payload);
+    CFE_SB_TimeStampMsg(&Data->Replay.Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Data->Replay.Tlm.TlmHeader.Msg, true);
+
+    ROS_APP_Export_SendTlm(&Data->Export);
+    ROS_APP_Sched_SendTlm(&Data->Sched);
+    ROS_APP_Tasks_SendTlm(&Data->Tasks);
+    ROS_APP_Alert_SendTlm(&Data->Alert);
+    ROS_APP_Tmpl_SendTlm(&Data->Tmpl);
+    ROS_APP_EvsFwd_SendTlm(&Data->EvsFwd);
+    ROS_APP_Filter_SendTlm(&Data->Filter);
+    ROS_APP_Seq_SendTlm(&Data->Seq);
+    ROS_APP_Clock_SendTlm(&Data->Clock);
+
+    /*
+    ** Keep the counters in the flight recorder current
+    */
+    memset(&Counters, 0, sizeof(Counters));
+    Counters.RosoutMsgCount = Data->RosoutMsgCount;
+    Counters.CmdCounter     = Data->CmdCounter;
+    Counters.ErrCounter     = Data->ErrCounter;
+    ROS_APP_Recorder_SaveCounters(&Data->Recorder, &Counters);
 
     /*
     ** Manage any pending table loads, validations, etc.
     */
+    CFE_ES_PerfLogEntry(ROS_APP_TBL_PERF_ID);
+    StageStart = ROS_APP_Perf_Start();
+
     for (i = 0; i < ROS_APP_NUMBER_OF_TABLES; i++)
     {
-        CFE_TBL_Manage(ROS_APP_Data.TblHandles[i]);
+        CFE_TBL_Manage(Data->TblHandles[i]);
     }
 
+    ROS_APP_UpdateTableConfig(Data);
+
+    ROS_APP_Perf_Stop(&Data->Perf, ROS_APP_STAGE_TBL, StageStart);
+    CFE_ES_PerfLogExit(ROS_APP_TBL_PERF_ID);
+
     return CFE_SUCCESS;
 
 } /* End of ROS_APP_ReportHousekeeping() */
@@ -410,8 +965,89 @@ int32 ROS_APP_ReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg)
 /*         This function is triggered in response to a /rosout telemetry msg  */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
-int32 ROS_APP_ReportRosoutMsg(const ROS_APP_RosoutTlm_t *Msg)
+int32 ROS_APP_ReportRosoutMsg(ROS_APP_Data_t *Data, const ROS_APP_RosoutTlm_t *RawMsg)
 {
+    ROS_APP_RosoutTlm_t *Msg     = &Data->RosoutIn;
+    CFE_MSG_Size_t       MsgSize = 0;
+    uint8                Severity;
+    uint16               Weight;
+
+    Data->RosoutMsgCount++;
+
+    /*
+    ** Capture the packet as received, and count it toward a running
+    ** replay, whether or not it is kept below
+    */
+    ROS_APP_Replay_ProcessRosout(&Data->Replay, &RawMsg->TlmHeader.Msg);
+
+    CFE_MSG_GetSize(&RawMsg->TlmHeader.Msg, &MsgSize);
+    if (MsgSize != sizeof(*RawMsg))
+    {
+        Data->RosoutRejected++;
+        return CFE_SUCCESS;
+    }
+
+    /*
+    ** A node is alive whether or not its records are kept
+    */
+    ROS_APP_Liveness_Touch(&Data->Liveness, RawMsg->Payload.name);
+
+    /*
+    ** Filtered records still cost pipe space and CPU, so flow control
+    ** counts them too
+    */
+    Severity = ROS_APP_LevelToSeverity(RawMsg->Payload.level);
+    ROS_APP_Flow_Count(&Data->Flow, Severity);
+
+    /*
+    ** Drop records below their node's threshold before anything else
+    ** looks at them
+    */
+    if (!ROS_APP_Filter_Pass(&Data->Filter, Severity, RawMsg->Payload.name))
+    {
+        return CFE_SUCCESS;
+    }
+
+    /*
+    ** Work on a sanitized copy
+    */
+    memcpy(&Msg->TlmHeader, &RawMsg->TlmHeader, sizeof(Msg->TlmHeader));
+    if (ROS_APP_SanitizeRosout(&Msg->Payload, &RawMsg->Payload))
+    {
+        Data->RosoutRepaired++;
+    }
+
+    Severity = ROS_APP_LevelToSeverity(Msg->Payload.level);
+    ROS_APP_Clock_Sample(&Data->Clock, &Msg->TlmHeader.Msg, Msg->Payload.sec, Msg->Payload.nsec);
+
+    ROS_APP_Alert_Scan(&Data->Alert, Severity, Msg->Payload.name, Msg->Payload.msg,
+                       sizeof(Msg->Payload.msg));
+
+    ROS_APP_Recorder_Add(&Data->Recorder, Severity, &Msg->Payload);
+    ROS_APP_Lvc_Update(&Data->Lvc, Severity, Msg->Payload.name, Msg->Payload.sec, Msg->Payload.nsec,
+                       Msg->Payload.msg, sizeof(Msg->Payload.msg));
+
+    /*
+    ** In rollup mode the record is only counted.  Otherwise queue it for
+    ** downlink, unless sampling drops it.
+    */
+    if (Data->Rollup.Enabled)
+    {
+        ROS_APP_Rollup_Add(&Data->Rollup, Severity, Msg->Payload.name, Msg->Payload.sec, Msg->Payload.nsec,
+                           Msg->Payload.msg, sizeof(Msg->Payload.msg));
+        return CFE_SUCCESS;
+    }
+
+    Weight = ROS_APP_Sample_Weight(&Data->Sample, Severity, Msg->Payload.name, Msg->Payload.sec);
+    if (Weight != 0 && !ROS_APP_ForwardTemplated(Data, Msg, Severity, Weight))
+    {
+        Data->FwdTlm.Payload.Severity     = Severity;
+        Data->FwdTlm.Payload.SampleWeight = Weight;
+        memcpy(&Data->FwdTlm.Payload.Record, &Msg->Payload, sizeof(Data->FwdTlm.Payload.Record));
+        ROS_APP_Clock_Stamp(&Data->Clock, &Data->FwdTlm.TlmHeader.Msg, Msg->Payload.sec, Msg->Payload.nsec);
+        ROS_APP_Sched_Enqueue(&Data->Sched, Severity, &Data->FwdTlm.TlmHeader.Msg);
+    }
+
 #if 0  /* 0 for no output, 1 if you want to see the /rosout message */
    CFE_TIME_SysTime_t msg_time;
    char time_text_buffer[2048];
@@ -450,15 +1086,253 @@ int32 ROS_APP_ReportRosoutMsg(const ROS_APP_RosoutTlm_t *Msg)
 
 } /* End of ROS_APP_ReportRosoutMsg() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_ForwardTemplated                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Runs a record through template extraction and, when templated      */
+/*         forwarding is enabled, queues it as a template reference plus      */
+/*         parameters.  A template's definition is queued in the FATAL class  */
+/*         before its first use so that it always reaches the ground first.   */
+/*         Returns false if the caller should forward the full record.        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool ROS_APP_ForwardTemplated(ROS_APP_Data_t *Data, const ROS_APP_RosoutTlm_t *Msg, uint8 Severity, uint16 Weight)
+{
+    ROS_APP_RosoutTmpl_Payload_t *Rec = &Data->TmplFwdTlm.Payload;
+    bool                          NeedsDef;
+
+    if (!ROS_APP_Tmpl_Encode(&Data->Tmpl, Msg->Payload.msg, sizeof(Msg->Payload.msg), &Rec->Ref, Rec->Params,
+                             &Rec->ParamBytes, &NeedsDef) ||
+        !Data->Tmpl.Forward)
+    {
+        return false;
+    }
+
+    if (NeedsDef)
+    {
+        ROS_APP_Tmpl_BuildDef(&Data->Tmpl, &Rec->Ref, &Data->TmplDefTlm.Payload);
+        CFE_SB_TimeStampMsg(&Data->TmplDefTlm.TlmHeader.Msg);
+        if (!ROS_APP_Sched_Enqueue(&Data->Sched, ROS_APP_SEVERITY_FATAL, &Data->TmplDefTlm.TlmHeader.Msg))
+        {
+            /* The ground could not decode the record without it */
+            return false;
+        }
+        ROS_APP_Tmpl_SetAnnounced(&Data->Tmpl, &Rec->Ref);
+    }
+
+    Rec->Severity           = Severity;
+    Rec->SampleWeight       = Weight;
+    Rec->sec                = Msg->Payload.sec;
+    Rec->nsec               = Msg->Payload.nsec;
+    Rec->level              = Msg->Payload.level;
+    Rec->name_truncated     = Msg->Payload.name_truncated;
+    Rec->msg_truncated      = Msg->Payload.msg_truncated;
+    Rec->file_truncated     = Msg->Payload.file_truncated;
+    Rec->function_truncated = Msg->Payload.function_truncated;
+    Rec->line               = Msg->Payload.line;
+    memcpy(Rec->name, Msg->Payload.name, sizeof(Rec->name));
+    memcpy(Rec->file, Msg->Payload.file, sizeof(Rec->file));
+    memcpy(Rec->function, Msg->Payload.function, sizeof(Rec->function));
+
+    CFE_MSG_SetSize(&Data->TmplFwdTlm.TlmHeader.Msg,
+                    offsetof(ROS_APP_RosoutTmplTlm_t, Payload.Params) + Rec->ParamBytes);
+    ROS_APP_Clock_Stamp(&Data->Clock, &Data->TmplFwdTlm.TlmHeader.Msg, Rec->sec, Rec->nsec);
+    ROS_APP_Sched_Enqueue(&Data->Sched, Severity, &Data->TmplFwdTlm.TlmHeader.Msg);
+
+    return true;
+
+} /* End of ROS_APP_ForwardTemplated() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_ReportRosoutFrag                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         This function is triggered in response to a fragment of a long    */
+/*         /rosout msg.  Once all fragments are in, the reassembled message   */
+/*         is queued for downlink on ROS_APP_ROSOUT_LONG_MID unless sampling  */
+/*         drops it.                                                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32 ROS_APP_ReportRosoutFrag(ROS_APP_Data_t *Data, const ROS_APP_RosoutFragTlm_t *Msg)
+{
+    ROS_APP_RosoutLongTlm_t *LongMsg;
+    uint8                    Severity;
+
+    Data->RosoutMsgCount++;
+
+    ROS_APP_Replay_ProcessRosout(&Data->Replay, &Msg->TlmHeader.Msg);
+
+    LongMsg = ROS_APP_Reasm_ProcessFrag(&Data->Reasm, Msg);
+    if (LongMsg == NULL)
+    {
+        return CFE_SUCCESS;
+    }
+
+    ROS_APP_Liveness_Touch(&Data->Liveness, LongMsg->Payload.name);
+
+    /*
+    ** Count and filter the reassembled record as ReportRosoutMsg does a
+    ** short one
+    */
+    Severity = ROS_APP_LevelToSeverity(LongMsg->Payload.level);
+    ROS_APP_Flow_Count(&Data->Flow, Severity);
+
+    if (!ROS_APP_Filter_Pass(&Data->Filter, Severity, LongMsg->Payload.name))
+    {
+        return CFE_SUCCESS;
+    }
+
+    if (ROS_APP_SanitizeRosoutLong(&LongMsg->Payload))
+    {
+        Data->RosoutRepaired++;
+    }
+
+    Severity = ROS_APP_LevelToSeverity(LongMsg->Payload.level);
+
+    /*
+    ** The slot header may still hold an earlier record's time; the last
+    ** fragment's header has this one's arrival time
+    */
+    ROS_APP_Clock_Sample(&Data->Clock, &Msg->TlmHeader.Msg, LongMsg->Payload.sec, LongMsg->Payload.nsec);
+
+    ROS_APP_Alert_Scan(&Data->Alert, Severity, LongMsg->Payload.name, LongMsg->Payload.msg,
+                       sizeof(LongMsg->Payload.msg));
+
+    ROS_APP_Recorder_AddLong(&Data->Recorder, Severity, &LongMsg->Payload);
+    ROS_APP_Lvc_Update(&Data->Lvc, Severity, LongMsg->Payload.name, LongMsg->Payload.sec, LongMsg->Payload.nsec,
+                       LongMsg->Payload.msg, sizeof(LongMsg->Payload.msg));
+
+    if (Data->Rollup.Enabled)
+    {
+        ROS_APP_Rollup_Add(&Data->Rollup, Severity, LongMsg->Payload.name, LongMsg->Payload.sec,
+                           LongMsg->Payload.nsec, LongMsg->Payload.msg, sizeof(LongMsg->Payload.msg));
+        return CFE_SUCCESS;
+    }
+
+    LongMsg->Payload.SampleWeight =
+        ROS_APP_Sample_Weight(&Data->Sample, Severity, LongMsg->Payload.name, LongMsg->Payload.sec);
+    if (LongMsg->Payload.SampleWeight == 0)
+    {
+        return CFE_SUCCESS;
+    }
+
+    ROS_APP_Clock_Stamp(&Data->Clock, &LongMsg->TlmHeader.Msg, LongMsg->Payload.sec, LongMsg->Payload.nsec);
+    ROS_APP_Sched_Enqueue(&Data->Sched, Severity, &LongMsg->TlmHeader.Msg);
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_ReportRosoutFrag() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_SchedTickTask -- Periodic task: release one tick of downlink      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_SchedTickTask(void *Arg)
+{
+    ROS_APP_Sched_Tick((ROS_APP_Sched_t *)Arg);
+
+} /* End of ROS_APP_SchedTickTask */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_ReasmExpireTask -- Periodic task: time out partial messages        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_ReasmExpireTask(void *Arg)
+{
+    ROS_APP_Reasm_Expire((ROS_APP_Reasm_t *)Arg);
+
+} /* End of ROS_APP_ReasmExpireTask */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_LivenessTask -- Periodic task: report nodes that went silent       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_LivenessTask(void *Arg)
+{
+    ROS_APP_Liveness_Advance((ROS_APP_Liveness_t *)Arg);
+
+} /* End of ROS_APP_LivenessTask */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_ClockSampleTask -- Periodic task: refit the ROS-to-cFE clock model */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_ClockSampleTask(void *Arg)
+{
+    ROS_APP_Clock_Update((ROS_APP_Clock_t *)Arg);
+
+} /* End of ROS_APP_ClockSampleTask */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_EvsFlushTask -- Periodic task: send a partly filled event batch    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_EvsFlushTask(void *Arg)
+{
+    ROS_APP_EvsFwd_Flush((ROS_APP_EvsFwd_t *)Arg);
+
+} /* End of ROS_APP_EvsFlushTask */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_FlowCheckTask -- Periodic task: update the flow control advice     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_FlowCheckTask(void *Arg)
+{
+    ROS_APP_Data_t *Data = (ROS_APP_Data_t *)Arg;
+
+    ROS_APP_Flow_Check(&Data->Flow, ROS_APP_Sched_FillPct(&Data->Sched));
+
+} /* End of ROS_APP_FlowCheckTask */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_RollupTask -- Periodic task: send the summary when it is due       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_RollupTask(void *Arg)
+{
+    ROS_APP_Data_t *Data = (ROS_APP_Data_t *)Arg;
+
+    if (ROS_APP_Rollup_Due(&Data->Rollup))
+    {
+        ROS_APP_SendRollup(Data);
+    }
+
+} /* End of ROS_APP_RollupTask */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_SendRollup                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Queues the current rollup summary in the FATAL class, so it goes   */
+/*         out ahead of anything else on a thin link, and starts the next     */
+/*         interval.                                                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_SendRollup(ROS_APP_Data_t *Data)
+{
+    ROS_APP_Sched_Enqueue(&Data->Sched, ROS_APP_SEVERITY_FATAL, ROS_APP_Rollup_Finish(&Data->Rollup));
+    ROS_APP_Rollup_Start(&Data->Rollup);
+
+} /* End of ROS_APP_SendRollup */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /* ROS_APP_Noop -- ROS NOOP commands                                        */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-int32 ROS_APP_Noop(const ROS_APP_NoopCmd_t *Msg)
+int32 ROS_APP_Noop(ROS_APP_Data_t *Data, const ROS_APP_NoopCmd_t *Msg)
 {
 
-    ROS_APP_Data.CmdCounter++;
+    Data->CmdCounter++;
 
     CFE_EVS_SendEvent(ROS_APP_COMMANDNOP_INF_EID, CFE_EVS_EventType_INFORMATION, "ros: NOOP command %s",
                       ROS_APP_VERSION);
@@ -473,11 +1347,11 @@ int32 ROS_APP_Noop(const ROS_APP_NoopCmd_t *Msg)
 /* ROS_APP_HelloCmd -- ros NOOP commands                                        */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-void ROS_APP_HelloCmd(const ROS_APP_NoopCmd_t *Msg)
+void ROS_APP_HelloCmd(ROS_APP_Data_t *Data, const ROS_APP_NoopCmd_t *Msg)
 {
     CFE_TIME_SysTime_t current_met;
 
-    ROS_APP_Data.CmdCounter++;
+    Data->CmdCounter++;
 
     current_met = CFE_TIME_GetMET();
 
@@ -496,11 +1370,28 @@ void ROS_APP_HelloCmd(const ROS_APP_NoopCmd_t *Msg)
 /*         part of the task telemetry.                                        */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
-int32 ROS_APP_ResetCounters(const ROS_APP_ResetCountersCmd_t *Msg)
+int32 ROS_APP_ResetCounters(ROS_APP_Data_t *Data, const ROS_APP_ResetCountersCmd_t *Msg)
 {
 
-    ROS_APP_Data.CmdCounter = 0;
-    ROS_APP_Data.ErrCounter = 0;
+    Data->CmdCounter = 0;
+    Data->ErrCounter = 0;
+
+    Data->RosoutMsgCount = 0;
+    Data->RosoutRejected = 0;
+    Data->RosoutRepaired = 0;
+
+    ROS_APP_Reasm_ResetStats(&Data->Reasm);
+    ROS_APP_Sched_ResetStats(&Data->Sched);
+    ROS_APP_Tasks_ResetStats(&Data->Tasks);
+    ROS_APP_Alert_ResetStats(&Data->Alert);
+    memset(Data->Sample.SampledOut, 0, sizeof(Data->Sample.SampledOut));
+    ROS_APP_Tmpl_ResetStats(&Data->Tmpl);
+    ROS_APP_EvsFwd_ResetStats(&Data->EvsFwd);
+    ROS_APP_Flow_ResetStats(&Data->Flow);
+    ROS_APP_Filter_ResetStats(&Data->Filter);
+    ROS_APP_Seq_ResetStats(&Data->Seq);
+    ROS_APP_Liveness_ResetStats(&Data->Liveness);
+    ROS_APP_Clock_ResetStats(&Data->Clock);
 
     CFE_EVS_SendEvent(ROS_APP_COMMANDRST_INF_EID, CFE_EVS_EventType_INFORMATION, "ros: RESET command");
 
@@ -509,12 +1400,128 @@ int32 ROS_APP_ResetCounters(const ROS_APP_ResetCountersCmd_t *Msg)
 } /* End of ROS_APP_ResetCounters() */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_SendPerf -- Dump the per-stage execution time histograms           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_SendPerf(ROS_APP_Data_t *Data, const ROS_APP_SendPerfCmd_t *Msg)
+{
+    Data->CmdCounter++;
+
+    ROS_APP_Perf_SendTlm(&Data->Perf);
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_SendPerf() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_ResetPerf -- Clear the per-stage execution time histograms         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_ResetPerf(ROS_APP_Data_t *Data, const ROS_APP_ResetPerfCmd_t *Msg)
+{
+    Data->CmdCounter++;
+
+    ROS_APP_Perf_Reset(&Data->Perf);
+
+    CFE_EVS_SendEvent(ROS_APP_PERF_INF_EID, CFE_EVS_EventType_INFORMATION, "ros: perf histograms reset");
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_ResetPerf() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_DumpRecorder -- Send the flight recorder contents                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_DumpRecorder(ROS_APP_Data_t *Data, const ROS_APP_DumpRecorderCmd_t *Msg)
+{
+    Data->CmdCounter++;
+
+    ROS_APP_Recorder_SendTlm(&Data->Recorder);
+
+    CFE_EVS_SendEvent(ROS_APP_RECORDER_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "ros: flight recorder dumped, %u records",
+                      (unsigned int)Data->Recorder.Tlm.Payload.Records);
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_DumpRecorder() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_DumpLvc -- Send the newest record per node and severity            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_DumpLvc(ROS_APP_Data_t *Data, const ROS_APP_DumpLvcCmd_t *Msg)
+{
+    uint32 Packets;
+
+    Data->CmdCounter++;
+
+    Packets = ROS_APP_Lvc_Dump(&Data->Lvc);
+
+    CFE_EVS_SendEvent(ROS_APP_LVC_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "ros: last-value cache dumped, %u nodes in %u packets", (unsigned int)Data->Lvc.NodeCount,
+                      (unsigned int)Packets);
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_DumpLvc() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_SetRollup -- Switch between full forwarding and rollup summaries   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_SetRollup(ROS_APP_Data_t *Data, const ROS_APP_SetRollupCmd_t *Msg)
+{
+    if (Msg->Payload.Mode != ROS_APP_ROLLUP_OFF && Msg->Payload.Mode != ROS_APP_ROLLUP_ON)
+    {
+        CFE_EVS_SendEvent(ROS_APP_ROLLUP_ERR_EID, CFE_EVS_EventType_ERROR, "ros: invalid rollup mode %u",
+                          (unsigned int)Msg->Payload.Mode);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    if (Msg->Payload.Mode == ROS_APP_ROLLUP_ON && !Data->Rollup.Enabled)
+    {
+        ROS_APP_Rollup_Start(&Data->Rollup);
+        Data->Rollup.Enabled = true;
+    }
+    else if (Msg->Payload.Mode == ROS_APP_ROLLUP_OFF && Data->Rollup.Enabled)
+    {
+        /* Nothing counted so far is lost */
+        ROS_APP_SendRollup(Data);
+        Data->Rollup.Enabled = false;
+    }
+
+    Data->CmdCounter++;
+
+    if (Data->Rollup.Enabled)
+    {
+        CFE_EVS_SendEvent(ROS_APP_ROLLUP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "ros: rollup mode on, one summary every %lu ms", (unsigned long)Data->Rollup.IntervalMs);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(ROS_APP_ROLLUP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "ros: rollup mode off, forwarding every record");
+    }
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_SetRollup() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /* ROS_APP_VerifyCmdLength() -- Verify command packet length                   */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-bool ROS_APP_VerifyCmdLength(CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
+bool ROS_APP_VerifyCmdLength(ROS_APP_Data_t *Data, CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
 {
     bool              result       = true;
     size_t            ActualLength = 0;
@@ -538,7 +1545,7 @@ bool ROS_APP_VerifyCmdLength(CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
 
         result = false;
 
-        ROS_APP_Data.ErrCounter++;
+        Data->ErrCounter++;
     }
 
     return (result);
@@ -583,6 +1590,8 @@ int32 ROS_APP_TblValidationFunc(void *TblData)
 {
     int32               ReturnCode = CFE_SUCCESS;
     ROS_APP_Table_t *TblDataPtr = (ROS_APP_Table_t *)TblData;
+    uint32              i;
+    uint32              j;
 
     /*
     ** Ros Table Validation
@@ -593,10 +1602,215 @@ int32 ROS_APP_TblValidationFunc(void *TblData)
         ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
     }
 
+    /* The budget must be able to carry the largest packet in one tick */
+    if (TblDataPtr->DownlinkBytesPerTick < ROS_APP_SCHED_MAX_PACKET_BYTES)
+    {
+        ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    if (TblDataPtr->DownlinkWeights[ROS_APP_SEVERITY_DEBUG] == 0 ||
+        TblDataPtr->DownlinkWeights[ROS_APP_SEVERITY_INFO] == 0 ||
+        TblDataPtr->DownlinkWeights[ROS_APP_SEVERITY_WARN] == 0)
+    {
+        ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    for (i = 0; i < ROS_APP_SAMPLE_MAX_NODES; i++)
+    {
+        if (memchr(TblDataPtr->SampleNodes[i].Node, 0, sizeof(TblDataPtr->SampleNodes[i].Node)) == NULL)
+        {
+            ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+        }
+    }
+
+    if (TblDataPtr->EvsMinSeverity > ROS_APP_SEVERITY_COUNT)
+    {
+        ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    for (i = 0; i < ROS_APP_EVS_MAX_FILTERS; i++)
+    {
+        if (memchr(TblDataPtr->EvsFilters[i].App, 0, sizeof(TblDataPtr->EvsFilters[i].App)) == NULL ||
+            TblDataPtr->EvsFilters[i].MinSeverity > ROS_APP_SEVERITY_COUNT)
+        {
+            ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+        }
+    }
+
+    if (TblDataPtr->FlowHighPct > 100 || TblDataPtr->FlowLowPct >= TblDataPtr->FlowHighPct ||
+        TblDataPtr->FlowTargetPct == 0 || TblDataPtr->FlowTargetPct > 100)
+    {
+        ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    if (TblDataPtr->RollupIntervalSec == 0 || TblDataPtr->RollupIntervalSec > 3600)
+    {
+        ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    if (TblDataPtr->DefaultMinSeverity > ROS_APP_SEVERITY_COUNT)
+    {
+        ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    for (i = 0; i < ROS_APP_FILTER_MAX_NODES; i++)
+    {
+        if (memchr(TblDataPtr->NodeFilters[i].Node, 0, sizeof(TblDataPtr->NodeFilters[i].Node)) == NULL ||
+            TblDataPtr->NodeFilters[i].MinSeverity > ROS_APP_SEVERITY_COUNT)
+        {
+            ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+            continue;
+        }
+
+        for (j = 0; j < i && TblDataPtr->NodeFilters[i].Node[0] != 0; j++)
+        {
+            if (strncmp(TblDataPtr->NodeFilters[i].Node, TblDataPtr->NodeFilters[j].Node,
+                        sizeof(TblDataPtr->NodeFilters[i].Node)) == 0)
+            {
+                ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+            }
+        }
+    }
+
+    if (TblDataPtr->DefaultSilenceMs > ROS_APP_LIVENESS_MAX_SILENCE_MS)
+    {
+        ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    for (i = 0; i < ROS_APP_LIVENESS_TABLE_NODES; i++)
+    {
+        if (memchr(TblDataPtr->NodeSilence[i].Node, 0, sizeof(TblDataPtr->NodeSilence[i].Node)) == NULL ||
+            TblDataPtr->NodeSilence[i].SilenceMs > ROS_APP_LIVENESS_MAX_SILENCE_MS)
+        {
+            ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+            continue;
+        }
+
+        for (j = 0; j < i && TblDataPtr->NodeSilence[i].Node[0] != 0; j++)
+        {
+            if (strncmp(TblDataPtr->NodeSilence[i].Node, TblDataPtr->NodeSilence[j].Node,
+                        sizeof(TblDataPtr->NodeSilence[i].Node)) == 0)
+            {
+                ReturnCode = ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+            }
+        }
+    }
+
     return ReturnCode;
 
 } /* End of ROS_APP_TBLValidationFunc() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* ROS_APP_AlertTblValidationFunc -- Verify the alert patterns     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 ROS_APP_AlertTblValidationFunc(void *TblData)
+{
+    if (!ROS_APP_Alert_CheckTable((ROS_APP_AlertTable_t *)TblData))
+    {
+        return ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_AlertTblValidationFunc() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* ROS_APP_UpdateTableConfig -- Apply table settings to the app    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void ROS_APP_UpdateTableConfig(ROS_APP_Data_t *Data)
+{
+    int32                 status;
+    ROS_APP_Table_t      *TblPtr;
+    ROS_APP_AlertTable_t *AlertTblPtr;
+    bool                  EvsEnable;
+
+    /*
+    ** Tables that are not loaded yet keep the defaults
+    */
+    status = CFE_TBL_GetAddress((void *)&TblPtr, Data->TblHandles[ROS_APP_TBL_IDX]);
+    if (status >= CFE_SUCCESS)
+    {
+        ROS_APP_Sched_Configure(&Data->Sched, TblPtr->DownlinkBytesPerTick, TblPtr->DownlinkWeights);
+        ROS_APP_Sample_Configure(&Data->Sample, TblPtr->SampleRates, TblPtr->SampleNodes);
+        Data->Tmpl.Forward = (TblPtr->TemplateForward != 0);
+
+        EvsEnable = (TblPtr->EvsForward != 0);
+        if (EvsEnable != Data->EvsFwd.Enabled && !ROS_APP_SubscribeEvents(Data, EvsEnable))
+        {
+            EvsEnable = Data->EvsFwd.Enabled;
+        }
+
+        ROS_APP_EvsFwd_Configure(&Data->EvsFwd, EvsEnable, TblPtr->EvsMinSeverity, TblPtr->EvsRatePerSec,
+                                 TblPtr->EvsBurst, TblPtr->EvsFilters);
+        ROS_APP_Flow_Configure(&Data->Flow, TblPtr->FlowHighPct, TblPtr->FlowLowPct, TblPtr->FlowTargetPct);
+        ROS_APP_Rollup_Configure(&Data->Rollup, TblPtr->RollupIntervalSec);
+
+        /*
+        ** The node hash and liveness timers are only rebuilt when a new
+        ** table is loaded
+        */
+        if (status == CFE_TBL_INFO_UPDATED)
+        {
+            ROS_APP_Filter_Compile(&Data->Filter, TblPtr->DefaultMinSeverity, TblPtr->NodeFilters);
+            ROS_APP_Liveness_Configure(&Data->Liveness, TblPtr->DefaultSilenceMs, TblPtr->NodeSilence);
+        }
+
+        CFE_TBL_ReleaseAddress(Data->TblHandles[ROS_APP_TBL_IDX]);
+    }
+
+    /*
+    ** The alert automaton is only rebuilt when a new table is loaded
+    */
+    status = CFE_TBL_GetAddress((void *)&AlertTblPtr, Data->TblHandles[ROS_APP_ALERT_TBL_IDX]);
+    if (status >= CFE_SUCCESS)
+    {
+        if (status == CFE_TBL_INFO_UPDATED)
+        {
+            ROS_APP_Alert_Compile(&Data->Alert, AlertTblPtr);
+        }
+
+        CFE_TBL_ReleaseAddress(Data->TblHandles[ROS_APP_ALERT_TBL_IDX]);
+    }
+
+} /* End of ROS_APP_UpdateTableConfig */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* ROS_APP_SubscribeEvents -- Start or stop receiving cFE events   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool ROS_APP_SubscribeEvents(ROS_APP_Data_t *Data, bool Enable)
+{
+    CFE_SB_MsgId_t EvsMid = CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID);
+    int32          status;
+
+    if (Enable)
+    {
+        status = CFE_SB_SubscribeEx(EvsMid, Data->CommandPipe, CFE_SB_DEFAULT_QOS, ROS_APP_EVS_MSG_LIMIT);
+    }
+    else
+    {
+        status = CFE_SB_Unsubscribe(EvsMid, Data->CommandPipe);
+    }
+
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("ros App: Error %s cFE events, RC = 0x%08lX\n",
+                             Enable ? "subscribing to" : "unsubscribing from", (unsigned long)status);
+        return false;
+    }
+
+    CFE_EVS_SendEvent(ROS_APP_EVSFWD_INF_EID, CFE_EVS_EventType_INFORMATION, "ros: instance %u %s cFE events",
+                      (unsigned int)Data->Instance, Enable ? "forwarding" : "stopped forwarding");
+
+    return true;
+
+} /* End of ROS_APP_SubscribeEvents */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*  Name:  ROS_APP_Process                                                     */
 /*                                                                            */
@@ -604,15 +1818,15 @@ int32 ROS_APP_TblValidationFunc(void *TblData)
 /*         This function Process Ground Station Command                       */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
-int32 ROS_APP_Process(const ROS_APP_ProcessCmd_t *Msg)
+int32 ROS_APP_Process(ROS_APP_Data_t *Data, const ROS_APP_ProcessCmd_t *Msg)
 {
     int32               status;
     ROS_APP_Table_t *TblPtr;
-    const char *        TableName = "ROS_APP.RosAppTable";
+    char                TableName[CFE_MISSION_TBL_MAX_FULL_NAME_LEN];
 
     /* Ros Use of Table */
 
-    status = CFE_TBL_GetAddress((void *)&TblPtr, ROS_APP_Data.TblHandles[0]);
+    status = CFE_TBL_GetAddress((void *)&TblPtr, Data->TblHandles[0]);
 
     if (status < CFE_SUCCESS)
     {
@@ -622,9 +1836,10 @@ int32 ROS_APP_Process(const ROS_APP_ProcessCmd_t *Msg)
 
     CFE_ES_WriteToSysLog("Ros App: Table Value 1: %d  Value 2: %d", TblPtr->Int1, TblPtr->Int2);
 
+    snprintf(TableName, sizeof(TableName), "ROS_APP.%s", Data->TblNames[ROS_APP_TBL_IDX]);
     ROS_APP_GetCrc(TableName);
 
-    status = CFE_TBL_ReleaseAddress(ROS_APP_Data.TblHandles[0]);
+    status = CFE_TBL_ReleaseAddress(Data->TblHandles[0]);
     if (status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("Ros App: Fail to release table address: 0x%08lx", (unsigned long)status);
@@ -40,15 +40,43 @@
 
 #include "ros_app_perfids.h"
 #include "ros_app_msgids.h"
+#include "ros_app_platform_cfg.h"
 #include "ros_app_msg.h"
+#include "ros_app_events.h"
+#include "ros_app_replay.h"
+#include "ros_app_loadgen.h"
+#include "ros_app_reasm.h"
+#include "ros_app_sched.h"
+#include "ros_app_tasks.h"
+#include "ros_app_perf.h"
+#include "ros_app_alert.h"
+#include "ros_app_sample.h"
+#include "ros_app_tmpl.h"
+#include "ros_app_evsfwd.h"
+#include "ros_app_recorder.h"
+#include "ros_app_sanitize.h"
+#include "ros_app_export.h"
+#include "ros_app_flow.h"
+#include "ros_app_rollup.h"
+#include "ros_app_filter.h"
+#include "ros_app_seq.h"
+#include "ros_app_lvc.h"
+#include "ros_app_liveness.h"
+#include "ros_app_clock.h"
 
 /***********************************************************************/
 #define ROS_APP_PIPE_DEPTH 32 /* Depth of the Command Pipe for Application */
 
-#define ROS_APP_NUMBER_OF_TABLES 1 /* Number of Table(s) */
+#define ROS_APP_NUMBER_OF_TABLES 2 /* Number of Table(s) */
 
-/* Define filenames of default data images for tables */
-#define ROS_APP_TABLE_FILE "/cf/ros_app_tbl.tbl"
+#define ROS_APP_TBL_IDX       0
+#define ROS_APP_ALERT_TBL_IDX 1
+
+/* Table names and default data images, suffixed with the instance number past instance 0 */
+#define ROS_APP_TABLE_NAME       "RosAppTable"
+#define ROS_APP_ALERT_TABLE_NAME "RosAppAlertTbl"
+#define ROS_APP_TABLE_FILE       "/cf/ros_app_tbl.tbl"
+#define ROS_APP_ALERT_TABLE_FILE "/cf/ros_app_alert_tbl.tbl"
 
 #define ROS_APP_TABLE_OUT_OF_RANGE_ERR_CODE -1
 
@@ -58,16 +86,83 @@
 *************************************************************************/
 
 /*
-** Global Data
+** Per-instance data
 */
 typedef struct
 {
+    /*
+    ** Instance identity, see ROS_APP_INSTANCE_COUNT
+    */
+    uint8           Instance;
+    uint32          MidOffset; /* Added to every ROS_APP_*_MID */
+    uint32          PerfId;
+    CFE_ES_TaskId_t TaskId;    /* Child task, unused for instance 0 */
+
     /*
     ** Command interface counters...
     */
     uint8 CmdCounter;
     uint8 ErrCounter;
 
+    /*
+    ** /rosout processing counters...
+    */
+    uint32 RosoutMsgCount;
+    uint32 RosoutRejected; /* Packets of the wrong size */
+    uint32 RosoutRepaired; /* Records with an unterminated field or control characters */
+    uint64 BusyUsec;       /* Time spent handling packets, for load measurements */
+
+    /*
+    ** Sanitized copy of the /rosout record being processed
+    */
+    ROS_APP_RosoutTlm_t RosoutIn;
+
+    /*
+    ** Reassembly of fragmented /rosout messages
+    */
+    ROS_APP_Reasm_t Reasm;
+
+    /*
+    ** Forwarding of /rosout records for downlink
+    */
+    ROS_APP_RosoutFwdTlm_t FwdTlm;
+    ROS_APP_Sched_t        Sched;
+
+    /*
+    ** Flow control advice to the ROS bridge
+    */
+    ROS_APP_Flow_t Flow;
+
+    /*
+    ** Rollup summaries sent in place of records on thin links
+    */
+    ROS_APP_Rollup_t Rollup;
+
+    /*
+    ** Per-node severity thresholds
+    */
+    ROS_APP_Filter_t Filter;
+
+    /*
+    ** Sequence gaps on ingest, sequence counts on downlinked products
+    */
+    ROS_APP_Seq_t Seq;
+
+    /*
+    ** Newest record per node and severity
+    */
+    ROS_APP_Lvc_t Lvc;
+
+    /*
+    ** Nodes that stopped logging
+    */
+    ROS_APP_Liveness_t Liveness;
+
+    /*
+    ** ROS-to-cFE clock correlation
+    */
+    ROS_APP_Clock_t Clock;
+
     /*
     ** Housekeeping telemetry packet...
     */
@@ -78,6 +173,43 @@ typedef struct
     */
     uint32 RunStatus;
 
+    /*
+    ** Periodic work
+    */
+    ROS_APP_Tasks_t Tasks;
+
+    /*
+    ** Per-stage execution time histograms
+    */
+    ROS_APP_Perf_t Perf;
+
+    /*
+    ** Alert pattern matcher
+    */
+    ROS_APP_Alert_t Alert;
+
+    /*
+    ** Sampling of low severity records
+    */
+    ROS_APP_Sample_t Sample;
+
+    /*
+    ** Template extraction and templated forwarding
+    */
+    ROS_APP_Tmpl_t          Tmpl;
+    ROS_APP_RosoutTmplTlm_t TmplFwdTlm;
+    ROS_APP_TmplDefTlm_t    TmplDefTlm;
+
+    /*
+    ** cFE events forwarded to ROS
+    */
+    ROS_APP_EvsFwd_t EvsFwd;
+
+    /*
+    ** Flight recorder kept in the Critical Data Store
+    */
+    ROS_APP_Recorder_t Recorder;
+
     /*
     ** Operational data (not reported in housekeeping)...
     */
@@ -89,11 +221,46 @@ typedef struct
     char   PipeName[CFE_MISSION_MAX_API_LEN];
     uint16 PipeDepth;
 
-    CFE_EVS_BinFilter_t EventFilters[ROS_APP_EVENT_COUNTS];
-    CFE_TBL_Handle_t    TblHandles[ROS_APP_NUMBER_OF_TABLES];
+    CFE_TBL_Handle_t TblHandles[ROS_APP_NUMBER_OF_TABLES];
+    char             TblNames[ROS_APP_NUMBER_OF_TABLES][CFE_MISSION_TBL_MAX_NAME_LENGTH];
+
+    /*
+    ** Bench capture/replay of the /rosout stream
+    */
+    ROS_APP_Replay_t Replay;
+
+    /*
+    ** Synthetic load generator
+    */
+    ROS_APP_LoadGen_t LoadGen;
+
+    /*
+    ** Export of capture files
+    */
+    ROS_APP_Export_t Export;
 
 } ROS_APP_Data_t;
 
+/*
+** Data shared by all instances
+*/
+typedef struct
+{
+    CFE_EVS_BinFilter_t EventFilters[ROS_APP_EVENT_COUNTS];
+
+    /*
+    ** Hands an instance to a child task as it starts, since child task
+    ** entry points take no argument
+    */
+    osal_id_t       StartMutex;
+    osal_id_t       StartSem;
+    ROS_APP_Data_t *Starting;
+
+} ROS_APP_Global_t;
+
+extern ROS_APP_Global_t ROS_APP_Global;
+extern ROS_APP_Data_t   ROS_APP_Data[ROS_APP_INSTANCE_COUNT];
+
 /****************************************************************************/
 /*
 ** Local function prototypes.
@@ -102,20 +269,58 @@ typedef struct
 **       functions are not called from any other source module.
 */
 void  ROS_APP_Main(void);
-int32 ROS_APP_Init(void);
-void  ROS_APP_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr);
-void  ROS_APP_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr);
-int32 ROS_APP_ReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg);
-int32 ROS_APP_ReportRosoutMsg(const ROS_APP_RosoutTlm_t *Msg);
-int32 ROS_APP_ResetCounters(const ROS_APP_ResetCountersCmd_t *Msg);
-int32 ROS_APP_Process(const ROS_APP_ProcessCmd_t *Msg);
-int32 ROS_APP_Noop(const ROS_APP_NoopCmd_t *Msg);
-void ROS_APP_HelloCmd(const ROS_APP_NoopCmd_t *Msg);
+int32 ROS_APP_AppInit(void);
+int32 ROS_APP_Init(ROS_APP_Data_t *Data);
+void  ROS_APP_InstanceTask(void);
+void  ROS_APP_ProcessPipe(ROS_APP_Data_t *Data);
+int32 ROS_APP_CreateChildTask(ROS_APP_Data_t *Data, CFE_ES_TaskId_t *TaskId, const char *BaseName,
+                              CFE_ES_ChildTaskMainFuncPtr_t Func, size_t StackSize,
+                              CFE_ES_TaskPriority_Atom_t Priority);
+ROS_APP_Data_t *ROS_APP_ChildTaskData(void);
+void  ROS_APP_ProcessCommandPacket(ROS_APP_Data_t *Data, CFE_SB_Buffer_t *SBBufPtr);
+void  ROS_APP_ProcessGroundCommand(ROS_APP_Data_t *Data, CFE_SB_Buffer_t *SBBufPtr);
+int32 ROS_APP_ReportHousekeeping(ROS_APP_Data_t *Data, const CFE_MSG_CommandHeader_t *Msg);
+int32 ROS_APP_ReportRosoutMsg(ROS_APP_Data_t *Data, const ROS_APP_RosoutTlm_t *RawMsg);
+bool  ROS_APP_ForwardTemplated(ROS_APP_Data_t *Data, const ROS_APP_RosoutTlm_t *Msg, uint8 Severity, uint16 Weight);
+int32 ROS_APP_ReportRosoutFrag(ROS_APP_Data_t *Data, const ROS_APP_RosoutFragTlm_t *Msg);
+int32 ROS_APP_ResetCounters(ROS_APP_Data_t *Data, const ROS_APP_ResetCountersCmd_t *Msg);
+int32 ROS_APP_Process(ROS_APP_Data_t *Data, const ROS_APP_ProcessCmd_t *Msg);
+int32 ROS_APP_Noop(ROS_APP_Data_t *Data, const ROS_APP_NoopCmd_t *Msg);
+int32 ROS_APP_SendPerf(ROS_APP_Data_t *Data, const ROS_APP_SendPerfCmd_t *Msg);
+int32 ROS_APP_ResetPerf(ROS_APP_Data_t *Data, const ROS_APP_ResetPerfCmd_t *Msg);
+int32 ROS_APP_DumpRecorder(ROS_APP_Data_t *Data, const ROS_APP_DumpRecorderCmd_t *Msg);
+int32 ROS_APP_SetRollup(ROS_APP_Data_t *Data, const ROS_APP_SetRollupCmd_t *Msg);
+int32 ROS_APP_DumpLvc(ROS_APP_Data_t *Data, const ROS_APP_DumpLvcCmd_t *Msg);
+void  ROS_APP_SendRollup(ROS_APP_Data_t *Data);
+void ROS_APP_HelloCmd(ROS_APP_Data_t *Data, const ROS_APP_NoopCmd_t *Msg);
 void  ROS_APP_GetCrc(const char *TableName);
+void  ROS_APP_UpdateTableConfig(ROS_APP_Data_t *Data);
+bool  ROS_APP_SubscribeEvents(ROS_APP_Data_t *Data, bool Enable);
+void  ROS_APP_SchedTickTask(void *Arg);
+void  ROS_APP_ReasmExpireTask(void *Arg);
+void  ROS_APP_LivenessTask(void *Arg);
+void  ROS_APP_ClockSampleTask(void *Arg);
+void  ROS_APP_EvsFlushTask(void *Arg);
+void  ROS_APP_FlowCheckTask(void *Arg);
+void  ROS_APP_RollupTask(void *Arg);
 
 int32 ROS_APP_TblValidationFunc(void *TblData);
+int32 ROS_APP_AlertTblValidationFunc(void *TblData);
+
+bool ROS_APP_VerifyCmdLength(ROS_APP_Data_t *Data, CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength);
 
-bool ROS_APP_VerifyCmdLength(CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength);
+/*
+** Command handlers implemented in the capture/replay, load generator and
+** export modules
+*/
+int32 ROS_APP_StartCapture(ROS_APP_Data_t *Data, const ROS_APP_StartCaptureCmd_t *Msg);
+int32 ROS_APP_StopCapture(ROS_APP_Data_t *Data, const ROS_APP_StopCaptureCmd_t *Msg);
+int32 ROS_APP_StartReplay(ROS_APP_Data_t *Data, const ROS_APP_StartReplayCmd_t *Msg);
+int32 ROS_APP_StopReplay(ROS_APP_Data_t *Data, const ROS_APP_StopReplayCmd_t *Msg);
+int32 ROS_APP_StartLoadGen(ROS_APP_Data_t *Data, const ROS_APP_StartLoadGenCmd_t *Msg);
+int32 ROS_APP_StopLoadGen(ROS_APP_Data_t *Data, const ROS_APP_StopLoadGenCmd_t *Msg);
+int32 ROS_APP_StartExport(ROS_APP_Data_t *Data, const ROS_APP_StartExportCmd_t *Msg);
+int32 ROS_APP_StopExport(ROS_APP_Data_t *Data, const ROS_APP_StopExportCmd_t *Msg);
 
 
 #endif /* _ros_app_h_ */
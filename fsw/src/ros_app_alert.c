@@ -0,0 +1,298 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_alert.c
+**
+** Purpose:
+**   Alert pattern matching on /rosout msg text.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_events.h"
+#include "ros_app_msgids.h"
+#include "ros_app_alert.h"
+#include "ros_app_utils.h"
+
+#include <string.h>
+
+#if ROS_APP_ALERT_MAX_PATTERNS > 32
+#error ROS_APP_ALERT_MAX_PATTERNS must fit in the uint32 match set
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Alert_Init                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Starts with an empty automaton that matches nothing.               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Alert_Init(ROS_APP_Alert_t *Alert, uint32 MidOffset)
+{
+    memset(Alert, 0, sizeof(*Alert));
+
+    CFE_MSG_Init(&Alert->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_ALERT_TLM_MID + MidOffset), sizeof(Alert->Tlm));
+
+} /* End of ROS_APP_Alert_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Alert_CheckTable                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Table validation: strings must be terminated, severities in range  */
+/*         and the patterns must not use more distinct characters than the    */
+/*         symbol alphabet holds.  The state limit cannot be exceeded.        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_Alert_CheckTable(const ROS_APP_AlertTable_t *Table)
+{
+    const ROS_APP_AlertPattern_t *Pattern;
+    bool                          Seen[256];
+    uint32                        Symbols = 1;
+    uint32                        i;
+    uint32                        j;
+    uint8                         c;
+
+    memset(Seen, 0, sizeof(Seen));
+
+    for (i = 0; i < ROS_APP_ALERT_MAX_PATTERNS; i++)
+    {
+        Pattern = &Table->Patterns[i];
+
+        if (memchr(Pattern->Text, 0, sizeof(Pattern->Text)) == NULL ||
+            memchr(Pattern->Node, 0, sizeof(Pattern->Node)) == NULL ||
+            Pattern->MinSeverity >= ROS_APP_SEVERITY_COUNT)
+        {
+            return false;
+        }
+
+        for (j = 0; Pattern->Text[j] != 0; j++)
+        {
+            c = (uint8)Pattern->Text[j];
+            if (!Seen[c])
+            {
+                Seen[c] = true;
+                Symbols++;
+            }
+        }
+    }
+
+    return (Symbols <= ROS_APP_ALERT_MAX_SYMBOLS);
+
+} /* End of ROS_APP_Alert_CheckTable() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Alert_Compile                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Builds the pattern trie, then fills in failure links breadth first */
+/*         and folds them into Next so that scanning never backtracks.  The   */
+/*         table must have passed ROS_APP_Alert_CheckTable.                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Alert_Compile(ROS_APP_Alert_t *Alert, const ROS_APP_AlertTable_t *Table)
+{
+    const char *Text;
+    uint32      Symbols  = 1;
+    uint32      States   = 1;
+    uint32      Patterns = 0;
+    uint32      QHead    = 0;
+    uint32      QTail    = 0;
+    uint32      State;
+    uint32      Child;
+    uint32      i;
+    uint8       Sym;
+
+    memset(Alert->SymbolOf, 0, sizeof(Alert->SymbolOf));
+    memset(Alert->Next, 0, sizeof(Alert->Next));
+    memset(Alert->Out, 0, sizeof(Alert->Out));
+    memset(Alert->Fail, 0, sizeof(Alert->Fail));
+
+    /*
+    ** Trie.  Next == 0 means no child yet; the root is never anyone's child.
+    */
+    for (i = 0; i < ROS_APP_ALERT_MAX_PATTERNS; i++)
+    {
+        Text = Table->Patterns[i].Text;
+        if (Text[0] == 0)
+        {
+            continue;
+        }
+
+        State = 0;
+        for (; *Text != 0; Text++)
+        {
+            Sym = Alert->SymbolOf[(uint8)*Text];
+            if (Sym == 0)
+            {
+                Sym                             = Symbols++;
+                Alert->SymbolOf[(uint8)*Text] = Sym;
+            }
+
+            if (Alert->Next[State][Sym] == 0)
+            {
+                Alert->Next[State][Sym] = States++;
+            }
+            State = Alert->Next[State][Sym];
+        }
+
+        Alert->Out[State] |= (uint32)1 << i;
+        Patterns++;
+    }
+
+    /*
+    ** Failure links.  Depth one states fail to the root.
+    */
+    for (Sym = 0; Sym < Symbols; Sym++)
+    {
+        Child = Alert->Next[0][Sym];
+        if (Child != 0)
+        {
+            Alert->Queue[QTail++] = Child;
+        }
+    }
+
+    while (QHead < QTail)
+    {
+        State = Alert->Queue[QHead++];
+
+        for (Sym = 0; Sym < Symbols; Sym++)
+        {
+            Child = Alert->Next[State][Sym];
+            if (Child != 0)
+            {
+                Alert->Fail[Child] = Alert->Next[Alert->Fail[State]][Sym];
+                Alert->Out[Child] |= Alert->Out[Alert->Fail[Child]];
+                Alert->Queue[QTail++] = Child;
+            }
+            else
+            {
+                Alert->Next[State][Sym] = Alert->Next[Alert->Fail[State]][Sym];
+            }
+        }
+    }
+
+    memcpy(Alert->Patterns, Table->Patterns, sizeof(Alert->Patterns));
+    memset(Alert->LastEventUsec, 0, sizeof(Alert->LastEventUsec));
+    Alert->HoldoffUsec = (uint64)Table->EventHoldoffMs * 1000;
+
+    Alert->Tlm.Payload.PatternCount = Patterns;
+    Alert->Tlm.Payload.StateCount   = States;
+
+    CFE_EVS_SendEvent(ROS_APP_ALERT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "ros: alert table loaded, %u patterns, %u states, %u symbols", (unsigned int)Patterns,
+                      (unsigned int)States, (unsigned int)Symbols);
+
+} /* End of ROS_APP_Alert_Compile() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Alert_Scan                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Runs one record's text through the automaton, then applies the     */
+/*         node and severity qualifiers of each pattern that matched.         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Alert_Scan(ROS_APP_Alert_t *Alert, uint8 Severity, const char *Node, const char *Text, uint32 MaxBytes)
+{
+    const ROS_APP_AlertPattern_t *Pattern;
+    uint32                        State = 0;
+    uint32                        Found = 0;
+    uint32                        i;
+    uint64                        Now;
+
+    if (Alert->Tlm.Payload.PatternCount == 0)
+    {
+        return;
+    }
+
+    Alert->Tlm.Payload.RecordsScanned++;
+
+    for (i = 0; i < MaxBytes && Text[i] != 0; i++)
+    {
+        State = Alert->Next[State][Alert->SymbolOf[(uint8)Text[i]]];
+        Found |= Alert->Out[State];
+    }
+
+    for (i = 0; Found != 0; i++, Found >>= 1)
+    {
+        if ((Found & 1) == 0)
+        {
+            continue;
+        }
+
+        Pattern = &Alert->Patterns[i];
+        if (Severity < Pattern->MinSeverity ||
+            (Pattern->Node[0] != 0 && strncmp(Pattern->Node, Node, ROS_APP_NODE_NAME_BYTES) != 0))
+        {
+            continue;
+        }
+
+        Alert->Tlm.Payload.Matches++;
+        Alert->Tlm.Payload.Hits[i]++;
+
+        Now = ROS_APP_GetTimeUsec();
+        if (Alert->LastEventUsec[i] != 0 && Now - Alert->LastEventUsec[i] < Alert->HoldoffUsec)
+        {
+            Alert->Tlm.Payload.EventsThrottled++;
+            continue;
+        }
+        Alert->LastEventUsec[i] = Now;
+        Alert->Tlm.Payload.EventsSent++;
+
+        CFE_EVS_SendEvent(ROS_APP_ALERT_MATCH_EID, CFE_EVS_EventType_ERROR,
+                          "ros: alert %u '%s' from %.*s: %.*s", (unsigned int)i, Pattern->Text,
+                          ROS_APP_NODE_NAME_BYTES, Node, (int)MaxBytes, Text);
+    }
+
+} /* End of ROS_APP_Alert_Scan() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Alert_ResetStats                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the hit counters.  The compiled table is kept.              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Alert_ResetStats(ROS_APP_Alert_t *Alert)
+{
+    Alert->Tlm.Payload.RecordsScanned  = 0;
+    Alert->Tlm.Payload.Matches         = 0;
+    Alert->Tlm.Payload.EventsSent      = 0;
+    Alert->Tlm.Payload.EventsThrottled = 0;
+    memset(Alert->Tlm.Payload.Hits, 0, sizeof(Alert->Tlm.Payload.Hits));
+
+} /* End of ROS_APP_Alert_ResetStats() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Alert_SendTlm                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the per-pattern hit counters.                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Alert_SendTlm(ROS_APP_Alert_t *Alert)
+{
+    CFE_SB_TimeStampMsg(&Alert->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Alert->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_Alert_SendTlm() */
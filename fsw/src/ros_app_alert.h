@@ -0,0 +1,83 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_alert.h
+**
+** Purpose:
+**   Alert pattern matching on /rosout msg text.
+**
+** Notes:
+**   The alert table is compiled into one Aho-Corasick automaton when it is
+**   loaded, so each record is matched in a single pass over its text no
+**   matter how many patterns there are.  Characters are mapped to a small
+**   symbol alphabet first; any character that appears in no pattern shares
+**   symbol 0.  Node and severity qualifiers are checked only for patterns
+**   that matched.
+**
+*******************************************************************************/
+#ifndef _ros_app_alert_h_
+#define _ros_app_alert_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+#include "ros_app_alert_table.h"
+
+/*
+** Compiled automaton and per-pattern state
+*/
+typedef struct
+{
+    uint8  SymbolOf[256];
+    uint16 Next[ROS_APP_ALERT_MAX_STATES][ROS_APP_ALERT_MAX_SYMBOLS];
+    uint32 Out[ROS_APP_ALERT_MAX_STATES]; /* Patterns that end at each state */
+
+    /*
+    ** Only used while compiling
+    */
+    uint16 Fail[ROS_APP_ALERT_MAX_STATES];
+    uint16 Queue[ROS_APP_ALERT_MAX_STATES];
+
+    /*
+    ** Copy of the qualifiers from the loaded table
+    */
+    ROS_APP_AlertPattern_t Patterns[ROS_APP_ALERT_MAX_PATTERNS];
+    uint64                 LastEventUsec[ROS_APP_ALERT_MAX_PATTERNS];
+    uint64                 HoldoffUsec;
+
+    ROS_APP_AlertTlm_t Tlm;
+
+} ROS_APP_Alert_t;
+
+/*
+** Exported functions
+*/
+void ROS_APP_Alert_Init(ROS_APP_Alert_t *Alert, uint32 MidOffset);
+bool ROS_APP_Alert_CheckTable(const ROS_APP_AlertTable_t *Table);
+void ROS_APP_Alert_Compile(ROS_APP_Alert_t *Alert, const ROS_APP_AlertTable_t *Table);
+void ROS_APP_Alert_Scan(ROS_APP_Alert_t *Alert, uint8 Severity, const char *Node, const char *Text, uint32 MaxBytes);
+void ROS_APP_Alert_ResetStats(ROS_APP_Alert_t *Alert);
+void ROS_APP_Alert_SendTlm(ROS_APP_Alert_t *Alert);
+
+#endif /* _ros_app_alert_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,371 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_clock.c
+**
+** Purpose:
+**   Correlates the ROS time in /rosout records with cFE time.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_clock.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+** Furthest the model is extrapolated, about 12 days, so that the drift
+** term cannot overflow
+*/
+#define ROS_APP_CLOCK_MAX_EXTRAP_USEC ((int64)1 << 40)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Clock_Predict                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the model's cFE-minus-ROS offset at a ROS time.            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static int64 ROS_APP_Clock_Predict(const ROS_APP_Clock_t *Clock, int64 RosUsec)
+{
+    int64 Delta = RosUsec - Clock->BaseRosUsec;
+
+    if (Delta > ROS_APP_CLOCK_MAX_EXTRAP_USEC)
+    {
+        Delta = ROS_APP_CLOCK_MAX_EXTRAP_USEC;
+    }
+    else if (Delta < -ROS_APP_CLOCK_MAX_EXTRAP_USEC)
+    {
+        Delta = -ROS_APP_CLOCK_MAX_EXTRAP_USEC;
+    }
+
+    return Clock->BaseOffsetUsec + (Delta * Clock->DriftPpb) / 1000000000;
+
+} /* End of ROS_APP_Clock_Predict() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Clock_Isqrt                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Integer square root, rounded down.                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint32 ROS_APP_Clock_Isqrt(uint64 Value)
+{
+    uint64 Root = 0;
+    uint64 Bit  = (uint64)1 << 62;
+
+    while (Bit > Value)
+    {
+        Bit >>= 2;
+    }
+
+    while (Bit != 0)
+    {
+        if (Value >= Root + Bit)
+        {
+            Value -= Root + Bit;
+            Root = (Root >> 1) + Bit;
+        }
+        else
+        {
+            Root >>= 1;
+        }
+        Bit >>= 2;
+    }
+
+    return (uint32)Root;
+
+} /* End of ROS_APP_Clock_Isqrt() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Clock_Fit                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Fits the offset and drift to the window and updates the            */
+/*         telemetry.  Deviations are taken from the window means so the      */
+/*         sums stay small; x is in ms and y in us for the drift sums.        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Clock_Fit(ROS_APP_Clock_t *Clock)
+{
+    ROS_APP_ClockTlm_Payload_t *Payload = &Clock->Tlm.Payload;
+    const ROS_APP_ClockSample_t *Sample;
+    int64                        SumX = 0;
+    int64                        SumY = 0;
+    int64                        MeanX;
+    int64                        MeanY;
+    int64                        Sxx = 0;
+    int64                        Sxy = 0;
+    int64                        Dx;
+    int64                        Dy;
+    int64                        Drift = 0;
+    int64                        Residual;
+    int64                        MinX;
+    int64                        MaxX;
+    uint64                       SumSq  = 0;
+    uint64                       MaxRes = 0;
+    int64                        Offset;
+    uint32                       i;
+
+    MinX = MaxX = Clock->Window[0].RosUsec;
+    for (i = 0; i < Clock->Count; i++)
+    {
+        Sample = &Clock->Window[i];
+        SumX += Sample->RosUsec - Clock->Window[0].RosUsec;
+        SumY += Sample->OffsetUsec - Clock->Window[0].OffsetUsec;
+
+        if (Sample->RosUsec < MinX)
+        {
+            MinX = Sample->RosUsec;
+        }
+        if (Sample->RosUsec > MaxX)
+        {
+            MaxX = Sample->RosUsec;
+        }
+    }
+
+    MeanX = Clock->Window[0].RosUsec + SumX / (int64)Clock->Count;
+    MeanY = Clock->Window[0].OffsetUsec + SumY / (int64)Clock->Count;
+
+    for (i = 0; i < Clock->Count; i++)
+    {
+        Dx = (Clock->Window[i].RosUsec - MeanX) / 1000;
+        Dy = Clock->Window[i].OffsetUsec - MeanY;
+        Sxx += Dx * Dx;
+        Sxy += Dx * Dy;
+    }
+
+    /*
+    ** Samples far apart in time can make the sums too large to scale
+    */
+    while (Sxy > INT64_MAX / 1000000 || Sxy < -(INT64_MAX / 1000000))
+    {
+        Sxy /= 2;
+        Sxx /= 2;
+    }
+
+    if (Sxx > 0)
+    {
+        Drift = (Sxy * 1000000) / Sxx;
+        if (Drift > ROS_APP_CLOCK_MAX_DRIFT_PPB)
+        {
+            Drift = ROS_APP_CLOCK_MAX_DRIFT_PPB;
+        }
+        else if (Drift < -ROS_APP_CLOCK_MAX_DRIFT_PPB)
+        {
+            Drift = -ROS_APP_CLOCK_MAX_DRIFT_PPB;
+        }
+    }
+
+    Clock->BaseRosUsec    = MeanX;
+    Clock->BaseOffsetUsec = MeanY;
+    Clock->DriftPpb       = (int32)Drift;
+    Clock->Valid          = (Clock->Count >= ROS_APP_CLOCK_MIN_SAMPLES);
+
+    for (i = 0; i < Clock->Count; i++)
+    {
+        Residual = Clock->Window[i].OffsetUsec - ROS_APP_Clock_Predict(Clock, Clock->Window[i].RosUsec);
+        if (Residual < 0)
+        {
+            Residual = -Residual;
+        }
+
+        SumSq += (uint64)(Residual * Residual);
+        if ((uint64)Residual > MaxRes)
+        {
+            MaxRes = (uint64)Residual;
+        }
+    }
+
+    /*
+    ** Offset is split so that the fraction is never negative
+    */
+    Offset = (MeanY >= 0) ? MeanY / 1000000 : -((-MeanY + 999999) / 1000000);
+
+    Payload->Valid           = Clock->Valid;
+    Payload->Samples         = (uint8)Clock->Count;
+    Payload->RefSec          = (uint32)(MeanX / 1000000);
+    Payload->RefNsec         = (uint32)(MeanX % 1000000) * 1000;
+    Payload->OffsetSec       = (int32)Offset;
+    Payload->OffsetUsec      = (uint32)(MeanY - Offset * 1000000);
+    Payload->DriftPpb        = Clock->DriftPpb;
+    Payload->ResidualUsec    = ROS_APP_Clock_Isqrt(SumSq / Clock->Count);
+    Payload->MaxResidualUsec = (MaxRes > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)MaxRes;
+    Payload->SpanMs          = (uint32)((MaxX - MinX) / 1000);
+
+} /* End of ROS_APP_Clock_Fit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Clock_Init                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Starts with an empty window; records keep the time they were       */
+/*         queued until the model is valid.                                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Clock_Init(ROS_APP_Clock_t *Clock, uint32 MidOffset)
+{
+    memset(Clock, 0, sizeof(*Clock));
+
+    CFE_MSG_Init(&Clock->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_CLOCK_TLM_MID + MidOffset),
+                 sizeof(Clock->Tlm));
+
+} /* End of ROS_APP_Clock_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Clock_Sample                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Offers one record's ROS and cFE times to the current interval.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Clock_Sample(ROS_APP_Clock_t *Clock, const CFE_MSG_Message_t *MsgPtr, uint32 Sec, uint32 Nsec)
+{
+    CFE_TIME_SysTime_t CfeTime = {0, 0};
+    int64              RosUsec;
+    int64              OffsetUsec;
+
+    CFE_MSG_GetMsgTime(MsgPtr, &CfeTime);
+    if (CfeTime.Seconds == 0 && CfeTime.Subseconds == 0)
+    {
+        CfeTime = CFE_TIME_GetTime();
+    }
+
+    RosUsec    = (int64)Sec * 1000000 + Nsec / 1000;
+    OffsetUsec = (int64)CfeTime.Seconds * 1000000 + CFE_TIME_Sub2MicroSecs(CfeTime.Subseconds) - RosUsec;
+
+    if (!Clock->Have || OffsetUsec < Clock->MinOffsetUsec)
+    {
+        Clock->Have          = true;
+        Clock->MinRosUsec    = RosUsec;
+        Clock->MinOffsetUsec = OffsetUsec;
+    }
+
+} /* End of ROS_APP_Clock_Sample() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Clock_Update                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Ends a sample interval: adds its sample to the window and refits.  */
+/*         A sample that jumps away from the model starts a new window.       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Clock_Update(ROS_APP_Clock_t *Clock)
+{
+    int64 Error;
+
+    if (!Clock->Have)
+    {
+        return;
+    }
+    Clock->Have = false;
+
+    if (Clock->Count > 0)
+    {
+        Error = Clock->MinOffsetUsec - ROS_APP_Clock_Predict(Clock, Clock->MinRosUsec);
+        if (Error > ROS_APP_CLOCK_STEP_USEC || Error < -ROS_APP_CLOCK_STEP_USEC)
+        {
+            Clock->Count = 0;
+            Clock->Next  = 0;
+            Clock->Tlm.Payload.Resets++;
+        }
+    }
+
+    Clock->Window[Clock->Next].RosUsec    = Clock->MinRosUsec;
+    Clock->Window[Clock->Next].OffsetUsec = Clock->MinOffsetUsec;
+    Clock->Next                           = (Clock->Next + 1) % ROS_APP_CLOCK_WINDOW;
+    if (Clock->Count < ROS_APP_CLOCK_WINDOW)
+    {
+        Clock->Count++;
+    }
+
+    ROS_APP_Clock_Fit(Clock);
+
+} /* End of ROS_APP_Clock_Update() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Clock_Stamp                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sets a packet's header time to its record's ROS time converted to  */
+/*         cFE time, or to the current time while there is no valid model.   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Clock_Stamp(ROS_APP_Clock_t *Clock, CFE_MSG_Message_t *MsgPtr, uint32 Sec, uint32 Nsec)
+{
+    CFE_TIME_SysTime_t CfeTime;
+    int64              RosUsec;
+    int64              CfeUsec;
+
+    if (!Clock->Valid)
+    {
+        CFE_SB_TimeStampMsg(MsgPtr);
+        return;
+    }
+
+    RosUsec = (int64)Sec * 1000000 + Nsec / 1000;
+    CfeUsec = RosUsec + ROS_APP_Clock_Predict(Clock, RosUsec);
+    if (CfeUsec < 0)
+    {
+        CFE_SB_TimeStampMsg(MsgPtr);
+        return;
+    }
+
+    CfeTime.Seconds    = (uint32)(CfeUsec / 1000000);
+    CfeTime.Subseconds = CFE_TIME_Micro2SubSecs((uint32)(CfeUsec % 1000000));
+    CFE_MSG_SetMsgTime(MsgPtr, CfeTime);
+
+    Clock->Tlm.Payload.Stamped++;
+
+} /* End of ROS_APP_Clock_Stamp() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Clock_ResetStats                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the reset and stamp counts.  The model is kept.             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Clock_ResetStats(ROS_APP_Clock_t *Clock)
+{
+    Clock->Tlm.Payload.Resets  = 0;
+    Clock->Tlm.Payload.Stamped = 0;
+
+} /* End of ROS_APP_Clock_ResetStats() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Clock_SendTlm                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the current offset, drift and residual.                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Clock_SendTlm(ROS_APP_Clock_t *Clock)
+{
+    CFE_SB_TimeStampMsg(&Clock->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Clock->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_Clock_SendTlm() */
@@ -0,0 +1,100 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_clock.h
+**
+** Purpose:
+**   Correlates the ROS time in /rosout records with cFE time.
+**
+** Notes:
+**   Each record pairs its ROS time with the cFE time in its SB header, or
+**   the time it arrived if the bridge left the header time at zero.  The
+**   cFE time can only trail the ROS time by the record's latency, so the
+**   smallest offset seen in each sample interval is kept as one sample.
+**   A least-squares line through the window gives the offset and the
+**   drift.  All arithmetic is 64-bit integer, in microseconds for times
+**   and parts per billion for drift; the window and the 1 s step limit
+**   keep every sum in range.
+**
+**   The model is refit once per sample interval, and every record stamped
+**   until the next refit uses the same offset and drift: one multiply and
+**   one add per record.
+**
+*******************************************************************************/
+#ifndef _ros_app_clock_h_
+#define _ros_app_clock_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+
+/*
+** One point of the window
+*/
+typedef struct
+{
+    int64 RosUsec;
+    int64 OffsetUsec; /* cFE minus ROS time */
+
+} ROS_APP_ClockSample_t;
+
+/*
+** Correlation state
+*/
+typedef struct
+{
+    /*
+    ** Current sample interval
+    */
+    bool  Have;
+    int64 MinRosUsec;
+    int64 MinOffsetUsec;
+
+    ROS_APP_ClockSample_t Window[ROS_APP_CLOCK_WINDOW];
+    uint32                Next;
+    uint32                Count;
+
+    /*
+    ** Model in use: Offset(t) = BaseOffsetUsec + DriftPpb * (t - BaseRosUsec) / 1e9
+    */
+    bool  Valid;
+    int64 BaseRosUsec;
+    int64 BaseOffsetUsec;
+    int32 DriftPpb;
+
+    ROS_APP_ClockTlm_t Tlm;
+
+} ROS_APP_Clock_t;
+
+/*
+** Exported functions
+*/
+void ROS_APP_Clock_Init(ROS_APP_Clock_t *Clock, uint32 MidOffset);
+void ROS_APP_Clock_Sample(ROS_APP_Clock_t *Clock, const CFE_MSG_Message_t *MsgPtr, uint32 Sec, uint32 Nsec);
+void ROS_APP_Clock_Update(ROS_APP_Clock_t *Clock);
+void ROS_APP_Clock_Stamp(ROS_APP_Clock_t *Clock, CFE_MSG_Message_t *MsgPtr, uint32 Sec, uint32 Nsec);
+void ROS_APP_Clock_ResetStats(ROS_APP_Clock_t *Clock);
+void ROS_APP_Clock_SendTlm(ROS_APP_Clock_t *Clock);
+
+#endif /* _ros_app_clock_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
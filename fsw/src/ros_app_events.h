@@ -38,6 +38,25 @@
 #define ROS_APP_LEN_ERR_EID           6
 #define ROS_APP_PIPE_ERR_EID          7
 #define ROS_APP_HELLO_WORLD_INF_EID   8
+#define ROS_APP_CAPTURE_INF_EID       9
+#define ROS_APP_CAPTURE_ERR_EID       10
+#define ROS_APP_REPLAY_INF_EID        11
+#define ROS_APP_REPLAY_ERR_EID        12
+#define ROS_APP_LOADGEN_INF_EID       13
+#define ROS_APP_LOADGEN_ERR_EID       14
+#define ROS_APP_TASK_OVERRUN_ERR_EID  15
+#define ROS_APP_PERF_INF_EID          16
+#define ROS_APP_ALERT_INF_EID         17
+#define ROS_APP_ALERT_MATCH_EID       18
+#define ROS_APP_EVSFWD_INF_EID        19
+#define ROS_APP_RECORDER_INF_EID      20
+#define ROS_APP_EXPORT_INF_EID        21
+#define ROS_APP_EXPORT_ERR_EID        22
+#define ROS_APP_ROLLUP_INF_EID        23
+#define ROS_APP_ROLLUP_ERR_EID        24
+#define ROS_APP_LVC_INF_EID           25
+#define ROS_APP_LIVENESS_INF_EID      26
+#define ROS_APP_LIVENESS_ERR_EID      27
 
 #define ROS_APP_EVENT_COUNTS 8
 
@@ -0,0 +1,329 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_evsfwd.c
+**
+** Purpose:
+**   Forwarding of cFE events to ROS in /rosout layout.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_evsfwd.h"
+#include "ros_app_utils.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#define ROS_APP_EVS_TOKEN 1000000 /* One event in the token bucket */
+
+/*
+** Severity for each CFE_EVS_EventType_*, and the ROS level for each severity
+*/
+static const uint8 ROS_APP_EvsSeverities[] = {
+    [CFE_EVS_EventType_DEBUG]       = ROS_APP_SEVERITY_DEBUG,
+    [CFE_EVS_EventType_INFORMATION] = ROS_APP_SEVERITY_INFO,
+    [CFE_EVS_EventType_ERROR]       = ROS_APP_SEVERITY_ERROR,
+    [CFE_EVS_EventType_CRITICAL]    = ROS_APP_SEVERITY_FATAL,
+};
+
+static const uint8 ROS_APP_EvsLevels[ROS_APP_SEVERITY_COUNT] = {10, 20, 30, 40, 50};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_EvsFwd_CopyText                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Copies a possibly unterminated string into a /rosout field and     */
+/*         returns true if it had to be cut short.                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool ROS_APP_EvsFwd_CopyText(char *Dst, size_t DstSize, const char *Src, size_t SrcSize)
+{
+    size_t Len = 0;
+
+    while (Len < SrcSize && Src[Len] != 0)
+    {
+        Len++;
+    }
+
+    if (Len >= DstSize)
+    {
+        memcpy(Dst, Src, DstSize - 1);
+        Dst[DstSize - 1] = 0;
+        return true;
+    }
+
+    memcpy(Dst, Src, Len);
+    Dst[Len] = 0;
+
+    return false;
+
+} /* End of ROS_APP_EvsFwd_CopyText() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_EvsFwd_Init                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Forwarding stays off until the table turns it on.                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_EvsFwd_Init(ROS_APP_EvsFwd_t *EvsFwd, uint32 MidOffset)
+{
+    memset(EvsFwd, 0, sizeof(*EvsFwd));
+
+    CFE_MSG_Init(&EvsFwd->Batch.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_EVS_BATCH_MID + MidOffset),
+                 sizeof(EvsFwd->Batch));
+    CFE_MSG_Init(&EvsFwd->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_EVS_FWD_TLM_MID + MidOffset),
+                 sizeof(EvsFwd->Tlm));
+
+} /* End of ROS_APP_EvsFwd_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_EvsFwd_Configure                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes the filters and rate cap from the table.  The bucket starts  */
+/*         full when forwarding is turned on.                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_EvsFwd_Configure(ROS_APP_EvsFwd_t *EvsFwd, bool Enable, uint8 MinSeverity, uint32 RatePerSec,
+                              uint16 Burst, const ROS_APP_EvsFilter_t *Filters)
+{
+    ROS_APP_EvsRule_t *Rule;
+    uint32             i;
+
+    EvsFwd->MinSeverity = MinSeverity;
+    EvsFwd->RatePerSec  = RatePerSec;
+    EvsFwd->TokenCap    = (uint64)((Burst > 0) ? Burst : 1) * ROS_APP_EVS_TOKEN;
+
+    if (Enable && !EvsFwd->Enabled)
+    {
+        EvsFwd->Tokens     = EvsFwd->TokenCap;
+        EvsFwd->RefillUsec = ROS_APP_GetTimeUsec();
+    }
+    else if (EvsFwd->Tokens > EvsFwd->TokenCap)
+    {
+        EvsFwd->Tokens = EvsFwd->TokenCap;
+    }
+
+    if (!Enable && EvsFwd->Enabled)
+    {
+        ROS_APP_EvsFwd_Flush(EvsFwd);
+    }
+
+    EvsFwd->Enabled             = Enable;
+    EvsFwd->Tlm.Payload.Enabled = Enable;
+
+    EvsFwd->RuleCount = 0;
+    for (i = 0; i < ROS_APP_EVS_MAX_FILTERS; i++)
+    {
+        if (Filters[i].App[0] == 0)
+        {
+            continue;
+        }
+
+        Rule = &EvsFwd->Rules[EvsFwd->RuleCount++];
+        memcpy(Rule->App, Filters[i].App, sizeof(Rule->App));
+        Rule->MinSeverity = Filters[i].MinSeverity;
+        Rule->NameHash    = ROS_APP_HashName(Rule->App, sizeof(Rule->App));
+    }
+
+} /* End of ROS_APP_EvsFwd_Configure() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_EvsFwd_Process                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Filters one EVS long-event packet, applies the rate cap and adds   */
+/*         the event to the current batch, sending the batch once full.       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_EvsFwd_Process(ROS_APP_EvsFwd_t *EvsFwd, const CFE_EVS_LongEventTlm_t *Msg)
+{
+    const CFE_EVS_PacketID_t    *PacketID = &Msg->Payload.PacketID;
+    ROS_APP_EvsBatch_Payload_t  *Batch    = &EvsFwd->Batch.Payload;
+    ROS_APP_EvsFwdTlm_Payload_t *Stats    = &EvsFwd->Tlm.Payload;
+    ROS_APP_Rosout_Payload_t    *Record;
+    CFE_TIME_SysTime_t           EventTime;
+    uint8                        Severity = ROS_APP_SEVERITY_INFO;
+    uint8                        MinSeverity;
+    uint32                       NameHash;
+    uint64                       Now;
+    uint64                       Elapsed;
+    uint32                       i;
+
+    Stats->Received++;
+
+    if (!EvsFwd->Enabled)
+    {
+        return; /* Already queued when the table turned forwarding off */
+    }
+
+    if (PacketID->EventType < sizeof(ROS_APP_EvsSeverities) && PacketID->EventType != 0)
+    {
+        Severity = ROS_APP_EvsSeverities[PacketID->EventType];
+    }
+
+    /*
+    ** App filter
+    */
+    MinSeverity = EvsFwd->MinSeverity;
+    NameHash    = ROS_APP_HashName(PacketID->AppName, sizeof(PacketID->AppName));
+
+    for (i = 0; i < EvsFwd->RuleCount; i++)
+    {
+        if (EvsFwd->Rules[i].NameHash == NameHash &&
+            strncmp(EvsFwd->Rules[i].App, PacketID->AppName, sizeof(EvsFwd->Rules[i].App)) == 0)
+        {
+            MinSeverity = EvsFwd->Rules[i].MinSeverity;
+            break;
+        }
+    }
+
+    if (Severity < MinSeverity)
+    {
+        Stats->Filtered[Severity]++;
+        return;
+    }
+
+    /*
+    ** Rate cap.  Long gaps are clamped so the refill cannot overflow.
+    */
+    if (EvsFwd->RatePerSec != 0)
+    {
+        Now     = ROS_APP_GetTimeUsec();
+        Elapsed = Now - EvsFwd->RefillUsec;
+        if (Elapsed > 3600000000ull)
+        {
+            Elapsed = 3600000000ull;
+        }
+
+        EvsFwd->RefillUsec = Now;
+        EvsFwd->Tokens += Elapsed * EvsFwd->RatePerSec;
+        if (EvsFwd->Tokens > EvsFwd->TokenCap)
+        {
+            EvsFwd->Tokens = EvsFwd->TokenCap;
+        }
+
+        if (EvsFwd->Tokens < ROS_APP_EVS_TOKEN)
+        {
+            Stats->RateLimited[Severity]++;
+            if (Batch->Dropped < 0xFFFF)
+            {
+                Batch->Dropped++;
+            }
+            return;
+        }
+
+        EvsFwd->Tokens -= ROS_APP_EVS_TOKEN;
+    }
+
+    /*
+    ** Convert
+    */
+    Record = &Batch->Records[Batch->Count];
+    memset(Record, 0, sizeof(*Record));
+
+    CFE_MSG_GetMsgTime(&Msg->TlmHeader.Msg, &EventTime);
+    Record->sec   = EventTime.Seconds;
+    Record->nsec  = CFE_TIME_Sub2MicroSecs(EventTime.Subseconds) * 1000;
+    Record->level = ROS_APP_EvsLevels[Severity];
+    Record->line  = PacketID->EventID;
+
+    Record->name_truncated =
+        ROS_APP_EvsFwd_CopyText(Record->name, sizeof(Record->name), PacketID->AppName, sizeof(PacketID->AppName));
+    Record->msg_truncated =
+        ROS_APP_EvsFwd_CopyText(Record->msg, sizeof(Record->msg), Msg->Payload.Message, sizeof(Msg->Payload.Message));
+    strncpy(Record->file, "cfe_evs", sizeof(Record->file) - 1);
+
+    Stats->Forwarded[Severity]++;
+
+    if (++Batch->Count >= ROS_APP_EVS_BATCH_RECORDS)
+    {
+        ROS_APP_EvsFwd_Flush(EvsFwd);
+    }
+
+} /* End of ROS_APP_EvsFwd_Process() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_EvsFwd_Flush                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the current batch, trimmed to the records it holds.  A batch */
+/*         with no records still goes out to report rate cap drops.           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_EvsFwd_Flush(ROS_APP_EvsFwd_t *EvsFwd)
+{
+    ROS_APP_EvsBatch_Payload_t *Batch = &EvsFwd->Batch.Payload;
+
+    if (Batch->Count == 0 && Batch->Dropped == 0)
+    {
+        return;
+    }
+
+    CFE_MSG_SetSize(&EvsFwd->Batch.TlmHeader.Msg,
+                    offsetof(ROS_APP_EvsBatchTlm_t, Payload.Records) + (Batch->Count * sizeof(Batch->Records[0])));
+    CFE_SB_TimeStampMsg(&EvsFwd->Batch.TlmHeader.Msg);
+
+    if (CFE_SB_TransmitMsg(&EvsFwd->Batch.TlmHeader.Msg, true) == CFE_SUCCESS)
+    {
+        EvsFwd->Tlm.Payload.Batches++;
+    }
+    else
+    {
+        EvsFwd->Tlm.Payload.BatchErrors++;
+    }
+
+    Batch->Count   = 0;
+    Batch->Dropped = 0;
+
+} /* End of ROS_APP_EvsFwd_Flush() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_EvsFwd_ResetStats                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the forwarding counters.                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_EvsFwd_ResetStats(ROS_APP_EvsFwd_t *EvsFwd)
+{
+    memset(&EvsFwd->Tlm.Payload, 0, sizeof(EvsFwd->Tlm.Payload));
+    EvsFwd->Tlm.Payload.Enabled = EvsFwd->Enabled;
+
+} /* End of ROS_APP_EvsFwd_ResetStats() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_EvsFwd_SendTlm                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the forwarding counters.                                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_EvsFwd_SendTlm(ROS_APP_EvsFwd_t *EvsFwd)
+{
+    CFE_SB_TimeStampMsg(&EvsFwd->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&EvsFwd->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_EvsFwd_SendTlm() */
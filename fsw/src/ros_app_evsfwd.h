@@ -0,0 +1,92 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_evsfwd.h
+**
+** Purpose:
+**   Forwarding of cFE events to ROS in /rosout layout.
+**
+** Notes:
+**   While EvsForward is set in the table ros_app subscribes to the EVS
+**   long-event packets, converts each event to a ROS_APP_Rosout_Payload_t
+**   and collects them in ROS_APP_EvsBatchTlm_t packets for the bridge to
+**   publish.  A batch goes out when it is full or, partly filled, at the
+**   next flush.  Events are filtered by app and severity first, then a
+**   token bucket caps the forwarded rate so an event storm cannot flood
+**   ROS; each batch reports how many events the cap dropped before it.
+**
+*******************************************************************************/
+#ifndef _ros_app_evsfwd_h_
+#define _ros_app_evsfwd_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_table.h"
+
+/*
+** One per-app filter, with its name hash cached
+*/
+typedef struct
+{
+    uint32 NameHash;
+    char   App[ROS_APP_EVS_APP_NAME_BYTES];
+    uint8  MinSeverity;
+
+} ROS_APP_EvsRule_t;
+
+/*
+** Forwarding state
+*/
+typedef struct
+{
+    bool              Enabled;
+    uint8             MinSeverity;
+    uint32            RuleCount;
+    ROS_APP_EvsRule_t Rules[ROS_APP_EVS_MAX_FILTERS];
+
+    /*
+    ** Rate cap, in millionths of an event
+    */
+    uint32 RatePerSec;
+    uint64 TokenCap;
+    uint64 Tokens;
+    uint64 RefillUsec;
+
+    ROS_APP_EvsBatchTlm_t Batch;
+    ROS_APP_EvsFwdTlm_t   Tlm;
+
+} ROS_APP_EvsFwd_t;
+
+/*
+** Exported functions
+*/
+void ROS_APP_EvsFwd_Init(ROS_APP_EvsFwd_t *EvsFwd, uint32 MidOffset);
+void ROS_APP_EvsFwd_Configure(ROS_APP_EvsFwd_t *EvsFwd, bool Enable, uint8 MinSeverity, uint32 RatePerSec,
+                              uint16 Burst, const ROS_APP_EvsFilter_t *Filters);
+void ROS_APP_EvsFwd_Process(ROS_APP_EvsFwd_t *EvsFwd, const CFE_EVS_LongEventTlm_t *Msg);
+void ROS_APP_EvsFwd_Flush(ROS_APP_EvsFwd_t *EvsFwd);
+void ROS_APP_EvsFwd_ResetStats(ROS_APP_EvsFwd_t *EvsFwd);
+void ROS_APP_EvsFwd_SendTlm(ROS_APP_EvsFwd_t *EvsFwd);
+
+#endif /* _ros_app_evsfwd_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,668 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_export.c
+**
+** Purpose:
+**   Export of the /rosout records in a capture file to CSV or a compact
+**   binary file, for downlink with CF.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_events.h"
+#include "ros_app.h"
+#include "ros_app_export.h"
+#include "ros_app_sanitize.h"
+#include "ros_app_utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define ROS_APP_EXPORT_CSV_COLUMNS "sec,nsec,level,name,file,function,line,flags,msg\n"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Export_Init                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Resets the export state and its telemetry packet.                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Export_Init(ROS_APP_Export_t *Export, uint32 MidOffset)
+{
+    memset(Export, 0, sizeof(*Export));
+
+    Export->MidOffset = MidOffset;
+    Export->State     = ROS_APP_EXPORT_STATE_IDLE;
+    Export->InFd      = OS_OBJECT_ID_UNDEFINED;
+    Export->OutFd     = OS_OBJECT_ID_UNDEFINED;
+    Export->FreeSem   = OS_OBJECT_ID_UNDEFINED;
+    Export->FullSem   = OS_OBJECT_ID_UNDEFINED;
+
+    CFE_MSG_Init(&Export->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_EXPORT_TLM_MID + MidOffset),
+                 sizeof(Export->Tlm));
+
+} /* End of ROS_APP_Export_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Export_BuildTlm                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Fills an export payload from the running counters, adding the     */
+/*         elapsed time, rates and progress.                                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Export_BuildTlm(ROS_APP_Export_t *Export, ROS_APP_ExportTlm_Payload_t *Payload)
+{
+    uint64 End;
+    uint64 Elapsed;
+
+    if (Payload != &Export->Tlm.Payload)
+    {
+        memcpy(Payload, &Export->Tlm.Payload, sizeof(*Payload));
+    }
+
+    Payload->State  = Export->State;
+    Payload->Format = Export->Format;
+
+    End     = (Export->State == ROS_APP_EXPORT_STATE_RUNNING) ? ROS_APP_GetTimeUsec() : Export->EndUsec;
+    Elapsed = (End > Export->StartUsec) ? (End - Export->StartUsec) : 0;
+
+    Payload->ElapsedMs     = (uint32)(Elapsed / 1000);
+    Payload->RecordsPerSec = 0;
+    Payload->BytesPerSec   = 0;
+
+    if (Elapsed > 0)
+    {
+        Payload->RecordsPerSec = (uint32)(((uint64)Payload->RecordsRead * 1000000) / Elapsed);
+        Payload->BytesPerSec   = (uint32)(((uint64)Payload->BytesWritten * 1000000) / Elapsed);
+    }
+
+    Payload->ProgressPermille = 0;
+    if (Payload->FileBytes > 0)
+    {
+        Payload->ProgressPermille = (uint16)(((uint64)Payload->BytesRead * 1000) / Payload->FileBytes);
+    }
+
+} /* End of ROS_APP_Export_BuildTlm() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Export_SendTlm                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the export progress packet.                                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Export_SendTlm(ROS_APP_Export_t *Export)
+{
+    ROS_APP_Export_BuildTlm(Export, &Export->Tlm.Payload);
+
+    CFE_SB_TimeStampMsg(&Export->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Export->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_Export_SendTlm() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Export_Select                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns true if the capture record in Buf is a complete /rosout    */
+/*         record in the time range, leaving its sanitized copy in Record.    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool ROS_APP_Export_Select(ROS_APP_Export_t *Export, uint32 MsgBytes)
+{
+    const ROS_APP_RosoutTlm_t *Msg   = (const ROS_APP_RosoutTlm_t *)&Export->Buf.SBBuf;
+    CFE_SB_MsgId_t             MsgId = CFE_SB_INVALID_MSG_ID;
+    uint32                     MidValue;
+
+    if (MsgBytes != sizeof(*Msg))
+    {
+        return false;
+    }
+
+    CFE_MSG_GetMsgId(&Export->Buf.SBBuf.Msg, &MsgId);
+    MidValue = CFE_SB_MsgIdToValue(MsgId) - Export->FileMidOffset;
+
+    if (MidValue < ROS_APP_ROSOUT_DEBUG_MID || MidValue > ROS_APP_ROSOUT_FATAL_MID)
+    {
+        return false;
+    }
+
+    if (Msg->Payload.sec < Export->StartSec || (Export->EndSec != 0 && Msg->Payload.sec >= Export->EndSec))
+    {
+        return false;
+    }
+
+    ROS_APP_SanitizeRosout(&Export->Record, &Msg->Payload);
+
+    return true;
+
+} /* End of ROS_APP_Export_Select() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Export_Flags                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Packs a record's truncation flags into ROS_APP_EXPORT_*_TRUNCATED. */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint8 ROS_APP_Export_Flags(const ROS_APP_Rosout_Payload_t *Record)
+{
+    return (Record->name_truncated ? ROS_APP_EXPORT_NAME_TRUNCATED : 0) |
+           (Record->msg_truncated ? ROS_APP_EXPORT_MSG_TRUNCATED : 0) |
+           (Record->file_truncated ? ROS_APP_EXPORT_FILE_TRUNCATED : 0) |
+           (Record->function_truncated ? ROS_APP_EXPORT_FUNCTION_TRUNCATED : 0);
+
+} /* End of ROS_APP_Export_Flags() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Export_CsvText                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Writes a text field as a quoted CSV value and returns its length.  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint32 ROS_APP_Export_CsvText(char *Dst, const char *Text)
+{
+    uint32 Len = 0;
+
+    Dst[Len++] = '"';
+
+    for (; *Text != 0; Text++)
+    {
+        if (*Text == '"')
+        {
+            Dst[Len++] = '"';
+        }
+
+        Dst[Len++] = *Text;
+    }
+
+    Dst[Len++] = '"';
+
+    return Len;
+
+} /* End of ROS_APP_Export_CsvText() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Export_Format                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Formats Record at Dst, which has room for                          */
+/*         ROS_APP_EXPORT_MAX_RECORD_BYTES, and returns the bytes used.       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint32 ROS_APP_Export_Format(uint8 Format, const ROS_APP_Rosout_Payload_t *Record, uint8 *Dst)
+{
+    ROS_APP_ExportRecHdr_t RecHdr;
+    char                  *Text = (char *)Dst;
+    uint32                 Len;
+
+    if (Format == ROS_APP_EXPORT_FORMAT_BINARY)
+    {
+        memset(&RecHdr, 0, sizeof(RecHdr));
+        RecHdr.sec           = Record->sec;
+        RecHdr.nsec          = Record->nsec;
+        RecHdr.line          = Record->line;
+        RecHdr.level         = Record->level;
+        RecHdr.Flags         = ROS_APP_Export_Flags(Record);
+        RecHdr.NameBytes     = (uint8)strlen(Record->name);
+        RecHdr.FileBytes     = (uint8)strlen(Record->file);
+        RecHdr.FunctionBytes = (uint8)strlen(Record->function);
+        RecHdr.MsgBytes      = (uint8)strlen(Record->msg);
+
+        Len = sizeof(RecHdr);
+        memcpy(Dst, &RecHdr, Len);
+        memcpy(&Dst[Len], Record->name, RecHdr.NameBytes);
+        Len += RecHdr.NameBytes;
+        memcpy(&Dst[Len], Record->file, RecHdr.FileBytes);
+        Len += RecHdr.FileBytes;
+        memcpy(&Dst[Len], Record->function, RecHdr.FunctionBytes);
+        Len += RecHdr.FunctionBytes;
+        memcpy(&Dst[Len], Record->msg, RecHdr.MsgBytes);
+        Len += RecHdr.MsgBytes;
+
+        return Len;
+    }
+
+    Len = (uint32)snprintf(Text, 32, "%lu,%lu,%u,", (unsigned long)Record->sec, (unsigned long)Record->nsec,
+                           (unsigned int)Record->level);
+    Len += ROS_APP_Export_CsvText(&Text[Len], Record->name);
+    Text[Len++] = ',';
+    Len += ROS_APP_Export_CsvText(&Text[Len], Record->file);
+    Text[Len++] = ',';
+    Len += ROS_APP_Export_CsvText(&Text[Len], Record->function);
+    Len += (uint32)snprintf(&Text[Len], 20, ",%lu,%u,", (unsigned long)Record->line,
+                            (unsigned int)ROS_APP_Export_Flags(Record));
+    Len += ROS_APP_Export_CsvText(&Text[Len], Record->msg);
+    Text[Len++] = '\n';
+
+    return Len;
+
+} /* End of ROS_APP_Export_Format() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Export_TakeBlock                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Waits for the writer to hand back a block, counting the waits.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Export_TakeBlock(ROS_APP_Export_t *Export)
+{
+    if (OS_CountSemTimedWait(Export->FreeSem, 0) != OS_SUCCESS)
+    {
+        Export->Tlm.Payload.WriterWaits++;
+        OS_CountSemTake(Export->FreeSem);
+    }
+
+} /* End of ROS_APP_Export_TakeBlock() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Export_GiveBlock                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Hands a block of Bytes to the writer; zero bytes ends the export.  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Export_GiveBlock(ROS_APP_Export_t *Export, uint32 Block, uint32 Bytes)
+{
+    Export->BlockBytes[Block] = Bytes;
+
+    if (Bytes > 0)
+    {
+        Export->Tlm.Payload.Blocks++;
+    }
+
+    OS_CountSemGive(Export->FullSem);
+
+} /* End of ROS_APP_Export_GiveBlock() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_ExportTask                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Child task entry point.  Reads the capture file and formats the    */
+/*         selected records into blocks for the writer task, giving up the    */
+/*         CPU after every ROS_APP_EXPORT_SLICE_USEC of work.                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_ExportTask(void)
+{
+    ROS_APP_Data_t              *Data   = ROS_APP_ChildTaskData();
+    ROS_APP_Export_t            *Export = &Data->Export;
+    ROS_APP_ExportTlm_Payload_t *Stats  = &Export->Tlm.Payload;
+    ROS_APP_ExportFileHdr_t      FileHdr;
+    ROS_APP_CaptureRecHdr_t      RecHdr;
+    uint32                       Block = 0;
+    uint32                       Used;
+    uint64                       SliceStart;
+    uint64                       Now;
+    int32                        status;
+
+    ROS_APP_Export_TakeBlock(Export);
+
+    if (Export->Format == ROS_APP_EXPORT_FORMAT_BINARY)
+    {
+        FileHdr.Magic       = ROS_APP_EXPORT_MAGIC;
+        FileHdr.Version     = ROS_APP_EXPORT_VERSION;
+        FileHdr.HeaderBytes = sizeof(FileHdr);
+        FileHdr.StartSec    = Export->StartSec;
+        FileHdr.EndSec      = Export->EndSec;
+
+        Used = sizeof(FileHdr);
+        memcpy(Export->Blocks[Block], &FileHdr, Used);
+    }
+    else
+    {
+        Used = sizeof(ROS_APP_EXPORT_CSV_COLUMNS) - 1;
+        memcpy(Export->Blocks[Block], ROS_APP_EXPORT_CSV_COLUMNS, Used);
+    }
+
+    SliceStart = ROS_APP_GetTimeUsec();
+
+    while (!Export->StopRequested)
+    {
+        status = OS_read(Export->InFd, &RecHdr, sizeof(RecHdr));
+        if (status == 0)
+        {
+            break; /* End of file */
+        }
+
+        if (status != sizeof(RecHdr) || RecHdr.MsgBytes < sizeof(CFE_MSG_Message_t) ||
+            RecHdr.MsgBytes > sizeof(Export->Buf) ||
+            OS_read(Export->InFd, Export->Buf.Bytes, RecHdr.MsgBytes) != (int32)RecHdr.MsgBytes)
+        {
+            Stats->ReadErrors++;
+            break;
+        }
+
+        Stats->BytesRead += sizeof(RecHdr) + RecHdr.MsgBytes;
+        Stats->RecordsRead++;
+
+        if (!ROS_APP_Export_Select(Export, RecHdr.MsgBytes))
+        {
+            Stats->RecordsSkipped++;
+        }
+        else
+        {
+            if (ROS_APP_EXPORT_BLOCK_BYTES - Used < ROS_APP_EXPORT_MAX_RECORD_BYTES)
+            {
+                ROS_APP_Export_GiveBlock(Export, Block, Used);
+                Block ^= 1;
+                Used = 0;
+                ROS_APP_Export_TakeBlock(Export);
+            }
+
+            Used += ROS_APP_Export_Format(Export->Format, &Export->Record, &Export->Blocks[Block][Used]);
+            Stats->RecordsExported++;
+        }
+
+        Now = ROS_APP_GetTimeUsec();
+        if (Now - SliceStart >= ROS_APP_EXPORT_SLICE_USEC)
+        {
+            OS_TaskDelay(ROS_APP_EXPORT_YIELD_MS);
+            Stats->Yields++;
+            SliceStart = ROS_APP_GetTimeUsec();
+        }
+    }
+
+    OS_close(Export->InFd);
+    Export->InFd = OS_OBJECT_ID_UNDEFINED;
+
+    /*
+    ** Hand over the last partial block, then the end marker
+    */
+    if (Used > 0)
+    {
+        ROS_APP_Export_GiveBlock(Export, Block, Used);
+        Block ^= 1;
+        ROS_APP_Export_TakeBlock(Export);
+    }
+
+    ROS_APP_Export_GiveBlock(Export, Block, 0);
+
+    CFE_ES_ExitChildTask();
+
+} /* End of ROS_APP_ExportTask() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_ExportWriterTask                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Child task entry point.  Writes blocks from the export task until  */
+/*         the end marker, then closes the file and reports the result.       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_ExportWriterTask(void)
+{
+    ROS_APP_Data_t      *Data   = ROS_APP_ChildTaskData();
+    ROS_APP_Export_t    *Export = &Data->Export;
+    ROS_APP_ExportTlm_t  Tlm;
+    uint32               Block = 0;
+    uint32               Bytes;
+
+    for (;;)
+    {
+        OS_CountSemTake(Export->FullSem);
+
+        Bytes = Export->BlockBytes[Block];
+        if (Bytes == 0)
+        {
+            break;
+        }
+
+        if (OS_write(Export->OutFd, Export->Blocks[Block], Bytes) == (int32)Bytes)
+        {
+            Export->Tlm.Payload.BytesWritten += Bytes;
+        }
+        else
+        {
+            Export->Tlm.Payload.WriteErrors++;
+        }
+
+        OS_CountSemGive(Export->FreeSem);
+        Block ^= 1;
+    }
+
+    /* Return the end marker's block so both are free for the next export */
+    OS_CountSemGive(Export->FreeSem);
+
+    OS_close(Export->OutFd);
+    Export->OutFd   = OS_OBJECT_ID_UNDEFINED;
+    Export->EndUsec = ROS_APP_GetTimeUsec();
+
+    Export->Tlm.Payload.Stopped = Export->StopRequested;
+
+    CFE_MSG_Init(&Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_EXPORT_TLM_MID + Export->MidOffset), sizeof(Tlm));
+    ROS_APP_Export_BuildTlm(Export, &Tlm.Payload);
+    Tlm.Payload.State = ROS_APP_EXPORT_STATE_IDLE;
+    CFE_SB_TimeStampMsg(&Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Tlm.TlmHeader.Msg, true);
+
+    CFE_EVS_SendEvent(ROS_APP_EXPORT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "ros: export to %s %s, %lu of %lu records, %lu bytes, %lu records/s, %lu errors",
+                      Export->OutFilename, Export->StopRequested ? "stopped" : "done",
+                      (unsigned long)Tlm.Payload.RecordsExported, (unsigned long)Tlm.Payload.RecordsRead,
+                      (unsigned long)Tlm.Payload.BytesWritten, (unsigned long)Tlm.Payload.RecordsPerSec,
+                      (unsigned long)(Tlm.Payload.ReadErrors + Tlm.Payload.WriteErrors));
+
+    Export->State = ROS_APP_EXPORT_STATE_IDLE;
+
+    CFE_ES_ExitChildTask();
+
+} /* End of ROS_APP_ExportWriterTask() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_StartExport -- Export a time range of a capture file               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_StartExport(ROS_APP_Data_t *Data, const ROS_APP_StartExportCmd_t *Msg)
+{
+    ROS_APP_Export_t        *Export = &Data->Export;
+    ROS_APP_CaptureFileHdr_t FileHdr;
+    char                     InFilename[CFE_MISSION_MAX_PATH_LEN];
+    char                     SemName[OS_MAX_API_NAME];
+    int32                    FileBytes;
+    int32                    status;
+
+    if (Export->State != ROS_APP_EXPORT_STATE_IDLE)
+    {
+        CFE_EVS_SendEvent(ROS_APP_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR, "ros: export already running");
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    if (Msg->Payload.Format > ROS_APP_EXPORT_FORMAT_BINARY)
+    {
+        CFE_EVS_SendEvent(ROS_APP_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR, "ros: invalid export format %u",
+                          (unsigned int)Msg->Payload.Format);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    /*
+    ** The block semaphores are made on first use and kept; every export
+    ** leaves them with both blocks free
+    */
+    if (!OS_ObjectIdDefined(Export->FreeSem))
+    {
+        ROS_APP_InstanceName(SemName, sizeof(SemName), "ROS_EXP_FREE", Data->Instance);
+        status = OS_CountSemCreate(&Export->FreeSem, SemName, 2, 0);
+        if (status == OS_SUCCESS)
+        {
+            ROS_APP_InstanceName(SemName, sizeof(SemName), "ROS_EXP_FULL", Data->Instance);
+            status = OS_CountSemCreate(&Export->FullSem, SemName, 0, 0);
+            if (status != OS_SUCCESS)
+            {
+                OS_CountSemDelete(Export->FreeSem);
+                Export->FreeSem = OS_OBJECT_ID_UNDEFINED;
+            }
+        }
+
+        if (status != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(ROS_APP_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "ros: unable to create export semaphores, RC = %ld", (long)status);
+            Data->ErrCounter++;
+            return CFE_SUCCESS;
+        }
+    }
+
+    CFE_SB_MessageStringGet(InFilename, Msg->Payload.InFilename, NULL, sizeof(InFilename),
+                            sizeof(Msg->Payload.InFilename));
+    CFE_SB_MessageStringGet(Export->OutFilename, Msg->Payload.OutFilename, NULL, sizeof(Export->OutFilename),
+                            sizeof(Msg->Payload.OutFilename));
+
+    status = OS_OpenCreate(&Export->InFd, InFilename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    if (status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(ROS_APP_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: unable to open capture file %s, RC = %ld", InFilename, (long)status);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    if (!ROS_APP_Replay_ReadFileHdr(Export->InFd, &FileHdr))
+    {
+        OS_close(Export->InFd);
+        Export->InFd = OS_OBJECT_ID_UNDEFINED;
+
+        CFE_EVS_SendEvent(ROS_APP_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR, "ros: %s is not a capture file",
+                          InFilename);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    /* The file size is only needed for progress, so a failed seek is not fatal */
+    FileBytes = OS_lseek(Export->InFd, 0, OS_SEEK_END);
+    if (OS_lseek(Export->InFd, FileHdr.HeaderBytes, OS_SEEK_SET) != FileHdr.HeaderBytes)
+    {
+        OS_close(Export->InFd);
+        Export->InFd = OS_OBJECT_ID_UNDEFINED;
+
+        CFE_EVS_SendEvent(ROS_APP_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR, "ros: unable to seek in %s",
+                          InFilename);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    status = OS_OpenCreate(&Export->OutFd, Export->OutFilename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                           OS_WRITE_ONLY);
+    if (status != OS_SUCCESS)
+    {
+        OS_close(Export->InFd);
+        Export->InFd = OS_OBJECT_ID_UNDEFINED;
+
+        CFE_EVS_SendEvent(ROS_APP_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: unable to create export file %s, RC = %ld", Export->OutFilename, (long)status);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    memset(&Export->Tlm.Payload, 0, sizeof(Export->Tlm.Payload));
+    Export->Tlm.Payload.FileBytes = (FileBytes > 0) ? (uint32)FileBytes : 0;
+    Export->Tlm.Payload.BytesRead = FileHdr.HeaderBytes;
+
+    Export->Format        = Msg->Payload.Format;
+    Export->StartSec      = Msg->Payload.StartSec;
+    Export->EndSec        = Msg->Payload.EndSec;
+    Export->FileMidOffset = FileHdr.MidOffset;
+    Export->StopRequested = false;
+    Export->StartUsec     = ROS_APP_GetTimeUsec();
+    Export->EndUsec       = Export->StartUsec;
+    Export->State         = ROS_APP_EXPORT_STATE_RUNNING;
+
+    /*
+    ** The writer goes first so the export task always has somewhere to
+    ** send its blocks
+    */
+    status = ROS_APP_CreateChildTask(Data, &Export->WriterTaskId, ROS_APP_EXPORT_WRITER_TASK_NAME,
+                                     ROS_APP_ExportWriterTask, ROS_APP_EXPORT_STACK_SIZE, ROS_APP_EXPORT_PRIORITY);
+    if (status != CFE_SUCCESS)
+    {
+        OS_close(Export->InFd);
+        Export->InFd = OS_OBJECT_ID_UNDEFINED;
+        OS_close(Export->OutFd);
+        Export->OutFd = OS_OBJECT_ID_UNDEFINED;
+        Export->State = ROS_APP_EXPORT_STATE_IDLE;
+
+        CFE_EVS_SendEvent(ROS_APP_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: unable to create export writer task, RC = 0x%08lX", (unsigned long)status);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    status = ROS_APP_CreateChildTask(Data, &Export->TaskId, ROS_APP_EXPORT_TASK_NAME, ROS_APP_ExportTask,
+                                     ROS_APP_EXPORT_STACK_SIZE, ROS_APP_EXPORT_PRIORITY);
+    if (status != CFE_SUCCESS)
+    {
+        OS_close(Export->InFd);
+        Export->InFd          = OS_OBJECT_ID_UNDEFINED;
+        Export->StopRequested = true;
+
+        /* Send the writer the end marker so it closes the file and exits */
+        OS_CountSemTake(Export->FreeSem);
+        Export->BlockBytes[0] = 0;
+        OS_CountSemGive(Export->FullSem);
+
+        CFE_EVS_SendEvent(ROS_APP_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: unable to create export task, RC = 0x%08lX", (unsigned long)status);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    Data->CmdCounter++;
+
+    CFE_EVS_SendEvent(ROS_APP_EXPORT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "ros: exporting %s to %s as %s, sec %lu to %lu", InFilename, Export->OutFilename,
+                      (Export->Format == ROS_APP_EXPORT_FORMAT_BINARY) ? "binary" : "CSV",
+                      (unsigned long)Export->StartSec, (unsigned long)Export->EndSec);
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_StartExport() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_StopExport -- Ask the export tasks to stop early                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_StopExport(ROS_APP_Data_t *Data, const ROS_APP_StopExportCmd_t *Msg)
+{
+    if (Data->Export.State != ROS_APP_EXPORT_STATE_RUNNING || Data->Export.StopRequested)
+    {
+        CFE_EVS_SendEvent(ROS_APP_EXPORT_ERR_EID, CFE_EVS_EventType_ERROR, "ros: no export running");
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    Data->Export.StopRequested = true;
+    Data->CmdCounter++;
+
+    CFE_EVS_SendEvent(ROS_APP_EXPORT_INF_EID, CFE_EVS_EventType_INFORMATION, "ros: export stop requested");
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_StopExport() */
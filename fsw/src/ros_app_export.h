@@ -0,0 +1,146 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_export.h
+**
+** Purpose:
+**   Export of the /rosout records in a capture file to CSV or a compact
+**   binary file, for downlink with CF.
+**
+** Notes:
+**   An export runs on two child tasks so command handling never waits on
+**   it.  The export task reads the capture file, sanitizes each record in
+**   the time range and formats it into one of two blocks; the writer task
+**   writes full blocks to the export file.  Fragments of long messages are
+**   skipped.
+**
+**   CSV files start with a column header line; text fields are quoted
+**   with embedded quotes doubled.  Binary files are a
+**   ROS_APP_ExportFileHdr_t followed by one ROS_APP_ExportRecHdr_t plus
+**   the name, file, function and msg text, without terminators, per
+**   record.  Like capture files they are in the byte order of the target.
+**
+*******************************************************************************/
+#ifndef _ros_app_export_h_
+#define _ros_app_export_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+
+#define ROS_APP_EXPORT_MAGIC   0x524C4F47 /* "RLOG" */
+#define ROS_APP_EXPORT_VERSION 1
+
+/*
+** Binary file layout
+*/
+typedef struct
+{
+    uint32 Magic;       /**< \brief ROS_APP_EXPORT_MAGIC */
+    uint16 Version;     /**< \brief ROS_APP_EXPORT_VERSION */
+    uint16 HeaderBytes; /**< \brief sizeof(ROS_APP_ExportFileHdr_t) */
+    uint32 StartSec;    /**< \brief Time range of the export */
+    uint32 EndSec;
+} ROS_APP_ExportFileHdr_t;
+
+#define ROS_APP_EXPORT_NAME_TRUNCATED     0x01
+#define ROS_APP_EXPORT_MSG_TRUNCATED      0x02
+#define ROS_APP_EXPORT_FILE_TRUNCATED     0x04
+#define ROS_APP_EXPORT_FUNCTION_TRUNCATED 0x08
+
+typedef struct
+{
+    uint32 sec;
+    uint32 nsec;
+    uint32 line;
+    uint8  level;
+    uint8  Flags;         /**< \brief ROS_APP_EXPORT_*_TRUNCATED */
+    uint8  NameBytes;     /**< \brief Bytes of text that follow, in field order */
+    uint8  FileBytes;
+    uint8  FunctionBytes;
+    uint8  MsgBytes;
+    uint8  spare[2];
+} ROS_APP_ExportRecHdr_t;
+
+/*
+** Most bytes one record can take in either format: every text byte a
+** doubled quote, plus the numeric columns
+*/
+#define ROS_APP_EXPORT_MAX_RECORD_BYTES                                                            \
+    (2 * (ROS_APP_ROSOUT_TLM_NAME_BYTES + ROS_APP_ROSOUT_TLM_MSG_BYTES + ROS_APP_ROSOUT_TLM_FILE_BYTES + \
+          ROS_APP_ROSOUT_TLM_FUNCTION_BYTES) + 64)
+
+/*
+** Export state, shared between the main task and the two export tasks
+*/
+typedef struct
+{
+    volatile uint8  State;
+    volatile bool   StopRequested;
+    uint8           Format;
+    uint32          StartSec;
+    uint32          EndSec;
+    uint32          FileMidOffset;
+    uint64          StartUsec;
+    uint64          EndUsec;
+    CFE_ES_TaskId_t TaskId;
+    CFE_ES_TaskId_t WriterTaskId;
+    osal_id_t       InFd;
+    osal_id_t       OutFd;
+    char            OutFilename[CFE_MISSION_MAX_PATH_LEN];
+
+    /*
+    ** Blocks go to the writer through FullSem and come back through
+    ** FreeSem.  A block of zero bytes ends the export.
+    */
+    osal_id_t FreeSem;
+    osal_id_t FullSem;
+    uint32    BlockBytes[2];
+    uint8     Blocks[2][ROS_APP_EXPORT_BLOCK_BYTES];
+
+    /*
+    ** Only touched by the export task
+    */
+    union
+    {
+        CFE_SB_Buffer_t SBBuf;
+        uint8           Bytes[ROS_APP_REPLAY_MAX_MSG_BYTES];
+    } Buf;
+    ROS_APP_Rosout_Payload_t Record;
+
+    ROS_APP_ExportTlm_t Tlm;
+
+    uint32 MidOffset; /* Of the owning instance */
+
+} ROS_APP_Export_t;
+
+/*
+** Exported functions
+*/
+void ROS_APP_Export_Init(ROS_APP_Export_t *Export, uint32 MidOffset);
+void ROS_APP_Export_SendTlm(ROS_APP_Export_t *Export);
+void ROS_APP_ExportTask(void);
+void ROS_APP_ExportWriterTask(void);
+
+#endif /* _ros_app_export_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
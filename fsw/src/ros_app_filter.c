@@ -0,0 +1,182 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_filter.c
+**
+** Purpose:
+**   Per-node severity thresholds for incoming /rosout records.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_filter.h"
+#include "ros_app_utils.h"
+
+#include <string.h>
+
+#if ROS_APP_FILTER_HASH_SLOTS < 2 * ROS_APP_FILTER_MAX_NODES || ROS_APP_FILTER_MAX_NODES >= ROS_APP_FILTER_NO_RULE
+#error ROS_APP_FILTER_HASH_SLOTS must be at least twice ROS_APP_FILTER_MAX_NODES
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Filter_Init                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Keeps everything until the table is activated.                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Filter_Init(ROS_APP_Filter_t *Filter, uint32 MidOffset)
+{
+    memset(Filter, 0, sizeof(*Filter));
+    memset(Filter->Slots, ROS_APP_FILTER_NO_RULE, sizeof(Filter->Slots));
+
+    Filter->DefaultMinSeverity = ROS_APP_SEVERITY_DEBUG;
+
+    CFE_MSG_Init(&Filter->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_FILTER_TLM_MID + MidOffset),
+                 sizeof(Filter->Tlm));
+
+} /* End of ROS_APP_Filter_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Filter_Compile                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Builds the node hash from a newly activated table and clears the   */
+/*         counts, which are indexed by table entry.  A repeated node keeps   */
+/*         its first entry; validation rejects tables that repeat one.        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Filter_Compile(ROS_APP_Filter_t *Filter, uint8 DefaultMinSeverity, const ROS_APP_NodeFilter_t *Nodes)
+{
+    ROS_APP_FilterRule_t *Rule;
+    uint32                Slot;
+    uint32                i;
+
+    Filter->DefaultMinSeverity = DefaultMinSeverity;
+
+    memset(Filter->Rules, 0, sizeof(Filter->Rules));
+    memset(Filter->Slots, ROS_APP_FILTER_NO_RULE, sizeof(Filter->Slots));
+    memset(&Filter->Tlm.Payload, 0, sizeof(Filter->Tlm.Payload));
+
+    for (i = 0; i < ROS_APP_FILTER_MAX_NODES; i++)
+    {
+        if (Nodes[i].Node[0] == 0)
+        {
+            continue;
+        }
+
+        Rule = &Filter->Rules[i];
+
+        strncpy(Rule->Node, Nodes[i].Node, sizeof(Rule->Node) - 1);
+        Rule->NameHash    = ROS_APP_HashName(Rule->Node, sizeof(Rule->Node));
+        Rule->MinSeverity = Nodes[i].MinSeverity;
+
+        Slot = Rule->NameHash & (ROS_APP_FILTER_HASH_SLOTS - 1);
+        while (Filter->Slots[Slot] != ROS_APP_FILTER_NO_RULE)
+        {
+            Slot = (Slot + 1) & (ROS_APP_FILTER_HASH_SLOTS - 1);
+        }
+        Filter->Slots[Slot] = (uint8)i;
+
+        Filter->Tlm.Payload.NodeCount++;
+    }
+
+    Filter->Tlm.Payload.DefaultMinSeverity = DefaultMinSeverity;
+
+} /* End of ROS_APP_Filter_Compile() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Filter_Pass                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns true if a record of this severity from the named node is   */
+/*         kept.  Name is a /rosout name field and need not be terminated.    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_Filter_Pass(ROS_APP_Filter_t *Filter, uint8 Severity, const char *Name)
+{
+    ROS_APP_FilterCounts_t *Counts = &Filter->Tlm.Payload.Default;
+    uint8                   MinSeverity = Filter->DefaultMinSeverity;
+    ROS_APP_FilterRule_t   *Rule;
+    uint32                  Hash;
+    uint32                  Slot;
+    uint8                   Index;
+
+    if (Filter->Tlm.Payload.NodeCount > 0)
+    {
+        Hash = ROS_APP_HashName(Name, ROS_APP_ROSOUT_TLM_NAME_BYTES);
+        Slot = Hash & (ROS_APP_FILTER_HASH_SLOTS - 1);
+
+        while ((Index = Filter->Slots[Slot]) != ROS_APP_FILTER_NO_RULE)
+        {
+            Rule = &Filter->Rules[Index];
+            if (Rule->NameHash == Hash && strncmp(Rule->Node, Name, ROS_APP_ROSOUT_TLM_NAME_BYTES) == 0)
+            {
+                Counts      = &Filter->Tlm.Payload.Nodes[Index];
+                MinSeverity = Rule->MinSeverity;
+                break;
+            }
+
+            Slot = (Slot + 1) & (ROS_APP_FILTER_HASH_SLOTS - 1);
+        }
+    }
+
+    Counts->Hits++;
+
+    if (Severity < MinSeverity)
+    {
+        Counts->Drops++;
+        return false;
+    }
+
+    return true;
+
+} /* End of ROS_APP_Filter_Pass() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Filter_ResetStats                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the per-node counts.                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Filter_ResetStats(ROS_APP_Filter_t *Filter)
+{
+    memset(&Filter->Tlm.Payload.Default, 0, sizeof(Filter->Tlm.Payload.Default));
+    memset(Filter->Tlm.Payload.Nodes, 0, sizeof(Filter->Tlm.Payload.Nodes));
+
+} /* End of ROS_APP_Filter_ResetStats() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Filter_SendTlm                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the per-node counts.                                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Filter_SendTlm(ROS_APP_Filter_t *Filter)
+{
+    CFE_SB_TimeStampMsg(&Filter->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Filter->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_Filter_SendTlm() */
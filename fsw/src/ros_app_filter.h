@@ -0,0 +1,82 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_filter.h
+**
+** Purpose:
+**   Per-node severity thresholds for incoming /rosout records.
+**
+** Notes:
+**   The node list from the table is compiled into an open-addressing hash
+**   of name hashes when the table is activated.  A record is checked on
+**   its level and name alone, before it is captured, sanitized or looked
+**   at by anything else; the name is read without assuming it is
+**   terminated.  Each listed node counts its records and drops, and nodes
+**   that are not listed share one pair of counts.
+**
+*******************************************************************************/
+#ifndef _ros_app_filter_h_
+#define _ros_app_filter_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_table.h"
+#include "ros_app_platform_cfg.h"
+
+#define ROS_APP_FILTER_NO_RULE 0xFF
+
+/*
+** One table entry, with its name hash cached
+*/
+typedef struct
+{
+    uint32 NameHash;
+    char   Node[ROS_APP_NODE_NAME_BYTES];
+    uint8  MinSeverity;
+
+} ROS_APP_FilterRule_t;
+
+/*
+** Filter state.  Rules are indexed like the table's NodeFilters.
+*/
+typedef struct
+{
+    uint8                DefaultMinSeverity;
+    ROS_APP_FilterRule_t Rules[ROS_APP_FILTER_MAX_NODES];
+    uint8                Slots[ROS_APP_FILTER_HASH_SLOTS]; /* Index into Rules, or ROS_APP_FILTER_NO_RULE */
+
+    ROS_APP_FilterTlm_t Tlm;
+
+} ROS_APP_Filter_t;
+
+/*
+** Exported functions
+*/
+void ROS_APP_Filter_Init(ROS_APP_Filter_t *Filter, uint32 MidOffset);
+void ROS_APP_Filter_Compile(ROS_APP_Filter_t *Filter, uint8 DefaultMinSeverity, const ROS_APP_NodeFilter_t *Nodes);
+bool ROS_APP_Filter_Pass(ROS_APP_Filter_t *Filter, uint8 Severity, const char *Name);
+void ROS_APP_Filter_ResetStats(ROS_APP_Filter_t *Filter);
+void ROS_APP_Filter_SendTlm(ROS_APP_Filter_t *Filter);
+
+#endif /* _ros_app_filter_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
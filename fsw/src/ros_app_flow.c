@@ -0,0 +1,276 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_flow.c
+**
+** Purpose:
+**   Flow control advice from ros_app to the ROS bridge.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_platform_cfg.h"
+#include "ros_app_flow.h"
+#include "ros_app_utils.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Flow_Init                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Starts NORMAL with the default watermarks.                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Flow_Init(ROS_APP_Flow_t *Flow, uint32 MidOffset, uint16 PipeDepth)
+{
+    uint32 i;
+
+    memset(Flow, 0, sizeof(*Flow));
+
+    Flow->HighPct   = ROS_APP_FLOW_DEFAULT_HIGH_PCT;
+    Flow->LowPct    = ROS_APP_FLOW_DEFAULT_LOW_PCT;
+    Flow->TargetPct = ROS_APP_FLOW_DEFAULT_TARGET_PCT;
+    Flow->PipeDepth = PipeDepth;
+
+    CFE_MSG_Init(&Flow->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_FLOW_CTL_MID + MidOffset),
+                 sizeof(Flow->Tlm));
+
+    Flow->Tlm.Payload.State           = ROS_APP_FLOW_STATE_NORMAL;
+    Flow->Tlm.Payload.BudgetMsgPerSec = ROS_APP_FLOW_UNLIMITED;
+    for (i = 0; i < ROS_APP_SEVERITY_COUNT; i++)
+    {
+        Flow->Tlm.Payload.MaxMsgPerSec[i] = ROS_APP_FLOW_UNLIMITED;
+    }
+
+    Flow->LastSendUsec = ROS_APP_GetTimeUsec();
+
+} /* End of ROS_APP_Flow_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Flow_Configure                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes the watermarks and target from the table.  The current       */
+/*         state is kept; the new watermarks apply from the next check.       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Flow_Configure(ROS_APP_Flow_t *Flow, uint8 HighPct, uint8 LowPct, uint8 TargetPct)
+{
+    Flow->HighPct   = HighPct;
+    Flow->LowPct    = LowPct;
+    Flow->TargetPct = TargetPct;
+
+} /* End of ROS_APP_Flow_Configure() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Flow_Count                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Counts one processed /rosout record.                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Flow_Count(ROS_APP_Flow_t *Flow, uint8 Severity)
+{
+    Flow->Received[Severity]++;
+
+} /* End of ROS_APP_Flow_Count() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Flow_Advise                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Splits the recommended total between the severities, highest      */
+/*         first, using the rates seen since the last advice.                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Flow_Advise(ROS_APP_Flow_t *Flow, uint64 WindowUsec)
+{
+    ROS_APP_FlowCtl_Payload_t *Payload   = &Flow->Tlm.Payload;
+    uint32                     Remaining = Payload->BudgetMsgPerSec;
+    uint64                     Observed;
+    uint32                     Severity;
+
+    for (Severity = ROS_APP_SEVERITY_COUNT; Severity-- > 0;)
+    {
+        Observed = ((uint64)Flow->Received[Severity] * 1000000) / WindowUsec;
+
+        if (Severity >= ROS_APP_SEVERITY_ERROR)
+        {
+            Payload->MaxMsgPerSec[Severity] = ROS_APP_FLOW_UNLIMITED;
+        }
+        else
+        {
+            Payload->MaxMsgPerSec[Severity] = Remaining;
+        }
+
+        Remaining -= (Observed < Remaining) ? (uint32)Observed : Remaining;
+    }
+
+} /* End of ROS_APP_Flow_Advise() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Flow_Check                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Periodic check of occupancy.  Sends the advice on every state      */
+/*         change and every ROS_APP_FLOW_REFRESH_MS.                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Flow_Check(ROS_APP_Flow_t *Flow, uint8 QueuePct)
+{
+    ROS_APP_FlowCtl_Payload_t *Payload = &Flow->Tlm.Payload;
+    uint64                     Now     = ROS_APP_GetTimeUsec();
+    uint64                     Window;
+    uint64                     Total = 0;
+    uint64                     Budget;
+    uint32                     Backlog;
+    uint8                      Level;
+    uint8                      WasState = Payload->State;
+    uint32                     i;
+
+    /*
+    ** A long run of waiting packets also happens while the pipe is busy
+    ** but shallow, so the pipe level is averaged over about four checks
+    */
+    Backlog = (Flow->Backlog < Flow->PipeDepth) ? Flow->Backlog : Flow->PipeDepth;
+    if (Flow->PipeDepth > 0)
+    {
+        Flow->PipeAvgPct = (Flow->PipeAvgPct * 3 + (Backlog * 100) / Flow->PipeDepth + 2) / 4;
+    }
+
+    Payload->PipePct  = (uint8)Flow->PipeAvgPct;
+    Payload->QueuePct = QueuePct;
+    Level             = (Payload->PipePct > QueuePct) ? Payload->PipePct : QueuePct;
+    Payload->LevelPct = Level;
+
+    if (WasState == ROS_APP_FLOW_STATE_NORMAL && Level >= Flow->HighPct)
+    {
+        Payload->State = ROS_APP_FLOW_STATE_CONGESTED;
+    }
+    else if (WasState == ROS_APP_FLOW_STATE_CONGESTED && Level <= Flow->LowPct)
+    {
+        Payload->State = ROS_APP_FLOW_STATE_NORMAL;
+    }
+    else if (Now - Flow->LastSendUsec < (uint64)ROS_APP_FLOW_REFRESH_MS * 1000)
+    {
+        return;
+    }
+
+    Window = Now - Flow->LastSendUsec;
+    if (Window == 0)
+    {
+        Window = 1;
+    }
+
+    for (i = 0; i < ROS_APP_SEVERITY_COUNT; i++)
+    {
+        Total += Flow->Received[i];
+    }
+    Total = (Total * 1000000) / Window;
+    Payload->ServiceMsgPerSec = (Total < ROS_APP_FLOW_UNLIMITED) ? (uint32)Total : ROS_APP_FLOW_UNLIMITED - 1;
+
+    if (WasState == ROS_APP_FLOW_STATE_CONGESTED)
+    {
+        Payload->CongestedMs += (uint32)(Window / 1000);
+    }
+
+    if (Payload->State != WasState)
+    {
+        Payload->Transitions++;
+    }
+
+    /*
+    ** Tighten on entry and while still at the high watermark.  Once NORMAL
+    ** again, loosen by the same factor until the processed rate fits well
+    ** under the limit, then lift it.
+    */
+    Budget = Payload->BudgetMsgPerSec;
+    if (Payload->State == ROS_APP_FLOW_STATE_CONGESTED)
+    {
+        if (Budget == ROS_APP_FLOW_UNLIMITED)
+        {
+            Budget = ((uint64)Payload->ServiceMsgPerSec * Flow->TargetPct) / 100;
+        }
+        else if (Level >= Flow->HighPct)
+        {
+            Budget = (Budget * Flow->TargetPct) / 100;
+        }
+    }
+    else if (Budget != ROS_APP_FLOW_UNLIMITED)
+    {
+        if (Payload->ServiceMsgPerSec < (Budget * Flow->TargetPct) / 100)
+        {
+            Budget = ROS_APP_FLOW_UNLIMITED;
+        }
+        else
+        {
+            Budget = (Budget * 100) / Flow->TargetPct;
+        }
+    }
+
+    if (Budget != ROS_APP_FLOW_UNLIMITED)
+    {
+        if (Budget < ROS_APP_FLOW_MIN_MSG_PER_SEC)
+        {
+            Budget = ROS_APP_FLOW_MIN_MSG_PER_SEC;
+        }
+        else if (Budget >= ROS_APP_FLOW_UNLIMITED)
+        {
+            Budget = ROS_APP_FLOW_UNLIMITED - 1;
+        }
+
+        Payload->BudgetMsgPerSec = (uint32)Budget;
+        ROS_APP_Flow_Advise(Flow, Window);
+    }
+    else
+    {
+        Payload->BudgetMsgPerSec = ROS_APP_FLOW_UNLIMITED;
+        for (i = 0; i < ROS_APP_SEVERITY_COUNT; i++)
+        {
+            Payload->MaxMsgPerSec[i] = ROS_APP_FLOW_UNLIMITED;
+        }
+    }
+
+    Payload->Seq++;
+    CFE_SB_TimeStampMsg(&Flow->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Flow->Tlm.TlmHeader.Msg, true);
+
+    memset(Flow->Received, 0, sizeof(Flow->Received));
+    Flow->LastSendUsec = Now;
+
+} /* End of ROS_APP_Flow_Check() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Flow_ResetStats                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the transition counters, keeping the current advice.        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Flow_ResetStats(ROS_APP_Flow_t *Flow)
+{
+    Flow->Tlm.Payload.Transitions = 0;
+    Flow->Tlm.Payload.CongestedMs = 0;
+
+} /* End of ROS_APP_Flow_ResetStats() */
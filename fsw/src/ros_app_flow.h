@@ -0,0 +1,90 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_flow.h
+**
+** Purpose:
+**   Flow control advice from ros_app to the ROS bridge.
+**
+** Notes:
+**   Software Bus drops packets silently once the command pipe is full, so
+**   ros_app tells the bridge when it is falling behind instead.  cFE has
+**   no call that returns a pipe's depth; the run loop polls the pipe
+**   before it pends, and Backlog counts the packets in a row that were
+**   already waiting.  That count, capped at the pipe depth and averaged
+**   over a few checks, stands in for pipe occupancy.  The fullest of the
+**   downlink queues is the other input.
+**
+**   The state goes CONGESTED when the higher of the two reaches the high
+**   watermark and back to NORMAL only when it falls to the low watermark.
+**   On entry the recommended total rate is TargetPct of the rate ros_app
+**   was processing, and it is cut by the same factor at each refresh that
+**   still finds occupancy at the high watermark.  Back in NORMAL it is
+**   raised by that factor at each refresh, and lifted once the processed
+**   rate is under TargetPct of it, so a bridge with more to send does not
+**   go straight back to full rate.
+**
+**   ERROR and FATAL are never limited; their observed rates come out of
+**   the total first, then WARN, INFO and DEBUG each get what the
+**   severities above them did not use.
+**
+*******************************************************************************/
+#ifndef _ros_app_flow_h_
+#define _ros_app_flow_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+
+/*
+** Flow control state
+*/
+typedef struct
+{
+    uint8  HighPct;
+    uint8  LowPct;
+    uint8  TargetPct;
+    uint16 PipeDepth;
+    uint32 Backlog; /* Packets in a row found waiting in the pipe, maintained by the run loop */
+    uint32 PipeAvgPct;
+
+    /*
+    ** /rosout records processed since the last advice, by severity
+    */
+    uint32 Received[ROS_APP_SEVERITY_COUNT];
+    uint64 LastSendUsec;
+
+    ROS_APP_FlowCtlTlm_t Tlm;
+
+} ROS_APP_Flow_t;
+
+/*
+** Exported functions
+*/
+void ROS_APP_Flow_Init(ROS_APP_Flow_t *Flow, uint32 MidOffset, uint16 PipeDepth);
+void ROS_APP_Flow_Configure(ROS_APP_Flow_t *Flow, uint8 HighPct, uint8 LowPct, uint8 TargetPct);
+void ROS_APP_Flow_Count(ROS_APP_Flow_t *Flow, uint8 Severity);
+void ROS_APP_Flow_Check(ROS_APP_Flow_t *Flow, uint8 QueuePct);
+void ROS_APP_Flow_ResetStats(ROS_APP_Flow_t *Flow);
+
+#endif /* _ros_app_flow_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,439 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_liveness.c
+**
+** Purpose:
+**   Node liveness: reports ROS nodes that stop sending /rosout records.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_events.h"
+#include "ros_app_liveness.h"
+#include "ros_app_utils.h"
+
+#include <string.h>
+
+#if ROS_APP_LIVENESS_HASH_SLOTS < 2 * ROS_APP_LIVENESS_MAX_NODES || \
+    ROS_APP_LIVENESS_MAX_NODES >= ROS_APP_LIVENESS_NONE
+#error ROS_APP_LIVENESS_HASH_SLOTS must be at least twice ROS_APP_LIVENESS_MAX_NODES
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_MsToTicks                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Converts a threshold to ticks, rounding up.                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint32 ROS_APP_Liveness_MsToTicks(uint32 Ms)
+{
+    return (Ms + ROS_APP_LIVENESS_TICK_MS - 1) / ROS_APP_LIVENESS_TICK_MS;
+
+} /* End of ROS_APP_Liveness_MsToTicks() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_SilenceFor                                        */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns a node's threshold in ticks from the table.                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint32 ROS_APP_Liveness_SilenceFor(const ROS_APP_Liveness_t *Live, const char *Name)
+{
+    uint32 i;
+
+    for (i = 0; i < ROS_APP_LIVENESS_TABLE_NODES; i++)
+    {
+        if (Live->Rules[i].Node[0] != 0 && strncmp(Live->Rules[i].Node, Name, ROS_APP_NODE_NAME_BYTES) == 0)
+        {
+            return ROS_APP_Liveness_MsToTicks(Live->Rules[i].SilenceMs);
+        }
+    }
+
+    return Live->DefaultSilenceTicks;
+
+} /* End of ROS_APP_Liveness_SilenceFor() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_FindNode                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the index of a node, adding it if there is room, or        */
+/*         ROS_APP_LIVENESS_NONE once the node table is full.  Name need not  */
+/*         be terminated.                                                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint16 ROS_APP_Liveness_FindNode(ROS_APP_Liveness_t *Live, const char *Name)
+{
+    ROS_APP_LivenessNode_t *Node;
+    uint32                  Hash;
+    uint32                  Slot;
+    uint32                  Probe;
+    uint16                  Index;
+
+    Hash = ROS_APP_HashName(Name, ROS_APP_NODE_NAME_BYTES - 1);
+    Slot = Hash & (ROS_APP_LIVENESS_HASH_SLOTS - 1);
+
+    for (Probe = 0; Probe < ROS_APP_LIVENESS_HASH_SLOTS; Probe++)
+    {
+        Index = Live->Slots[Slot];
+
+        if (Index == ROS_APP_LIVENESS_NONE)
+        {
+            if (Live->NodeCount >= ROS_APP_LIVENESS_MAX_NODES)
+            {
+                return ROS_APP_LIVENESS_NONE;
+            }
+
+            Index = (uint16)Live->NodeCount++;
+            Node  = &Live->Nodes[Index];
+
+            Live->Slots[Slot] = Index;
+            Node->NameHash    = Hash;
+            Node->LastSeen    = Live->CurTick;
+            Node->State       = ROS_APP_LIVENESS_NODE_IDLE;
+            strncpy(Node->Node, Name, sizeof(Node->Node) - 1);
+            Node->SilenceTicks = ROS_APP_Liveness_SilenceFor(Live, Node->Node);
+
+            return Index;
+        }
+
+        Node = &Live->Nodes[Index];
+        if (Node->NameHash == Hash && strncmp(Node->Node, Name, sizeof(Node->Node) - 1) == 0)
+        {
+            return Index;
+        }
+
+        Slot = (Slot + 1) & (ROS_APP_LIVENESS_HASH_SLOTS - 1);
+    }
+
+    return ROS_APP_LIVENESS_NONE;
+
+} /* End of ROS_APP_Liveness_FindNode() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_Insert                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Puts a node's timer in the lowest wheel level whose range covers   */
+/*         the deadline.  A deadline that has passed runs out on the next     */
+/*         tick.                                                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Liveness_Insert(ROS_APP_Liveness_t *Live, uint16 Index, uint32 Deadline)
+{
+    uint32 Now = Live->CurTick;
+    uint32 Level;
+    uint32 Shift = 0;
+    uint32 Slot;
+
+    if ((int32)(Deadline - Now) <= 0)
+    {
+        Deadline = Now + 1;
+    }
+
+    for (Level = 0; Level < ROS_APP_LIVENESS_WHEEL_LEVELS - 1; Level++)
+    {
+        Shift = Level * ROS_APP_LIVENESS_WHEEL_BITS;
+        if ((Deadline >> Shift) - (Now >> Shift) < ROS_APP_LIVENESS_WHEEL_SLOTS)
+        {
+            break;
+        }
+    }
+
+    Shift = Level * ROS_APP_LIVENESS_WHEEL_BITS;
+    if ((Deadline >> Shift) - (Now >> Shift) >= ROS_APP_LIVENESS_WHEEL_SLOTS)
+    {
+        Deadline = ((Now >> Shift) + ROS_APP_LIVENESS_WHEEL_SLOTS - 1) << Shift;
+    }
+
+    Slot = (Deadline >> Shift) & (ROS_APP_LIVENESS_WHEEL_SLOTS - 1);
+
+    Live->Nodes[Index].Next  = Live->Wheel[Level][Slot];
+    Live->Nodes[Index].State = ROS_APP_LIVENESS_NODE_ARMED;
+    Live->Wheel[Level][Slot] = Index;
+
+} /* End of ROS_APP_Liveness_Insert() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_Report                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the event and liveness packet for a node changing state.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Liveness_Report(ROS_APP_Liveness_t *Live, const ROS_APP_LivenessNode_t *Node, uint8 State)
+{
+    ROS_APP_LivenessTlm_Payload_t *Payload = &Live->Tlm.Payload;
+
+    Payload->Seq++;
+    Payload->Transitions++;
+    Payload->Tracked     = (uint16)Live->NodeCount;
+    Payload->State       = State;
+    Payload->SilenceMs   = Node->SilenceTicks * ROS_APP_LIVENESS_TICK_MS;
+    Payload->SilentForMs = (Live->CurTick - Node->LastSeen) * ROS_APP_LIVENESS_TICK_MS;
+    memcpy(Payload->Node, Node->Node, sizeof(Payload->Node));
+
+    if (State == ROS_APP_LIVENESS_SILENT)
+    {
+        Payload->Silent++;
+        CFE_EVS_SendEvent(ROS_APP_LIVENESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: node %s silent for %u ms", Node->Node, (unsigned int)Payload->SilentForMs);
+    }
+    else
+    {
+        Payload->Silent--;
+        CFE_EVS_SendEvent(ROS_APP_LIVENESS_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "ros: node %s heard from again after %u ms", Node->Node,
+                          (unsigned int)Payload->SilentForMs);
+    }
+
+    CFE_SB_TimeStampMsg(&Live->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Live->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_Liveness_Report() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_Expire                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Handles a timer that has run out: re-arms it from the node's       */
+/*         newest record, or reports the node silent.                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Liveness_Expire(ROS_APP_Liveness_t *Live, uint16 Index)
+{
+    ROS_APP_LivenessNode_t *Node     = &Live->Nodes[Index];
+    uint32                  Deadline = Node->LastSeen + Node->SilenceTicks;
+
+    if (Node->SilenceTicks == 0)
+    {
+        Node->State = ROS_APP_LIVENESS_NODE_IDLE;
+    }
+    else if ((int32)(Deadline - Live->CurTick) > 0)
+    {
+        ROS_APP_Liveness_Insert(Live, Index, Deadline);
+    }
+    else
+    {
+        Node->State = ROS_APP_LIVENESS_NODE_SILENT;
+        ROS_APP_Liveness_Report(Live, Node, ROS_APP_LIVENESS_SILENT);
+    }
+
+} /* End of ROS_APP_Liveness_Expire() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_Arm                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Starts the timer of a node without one, if the node is watched.    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Liveness_Arm(ROS_APP_Liveness_t *Live, uint16 Index)
+{
+    ROS_APP_LivenessNode_t *Node = &Live->Nodes[Index];
+
+    if (Node->State == ROS_APP_LIVENESS_NODE_IDLE && Node->SilenceTicks != 0)
+    {
+        ROS_APP_Liveness_Insert(Live, Index, Node->LastSeen + Node->SilenceTicks);
+    }
+
+} /* End of ROS_APP_Liveness_Arm() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_Init                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Starts with no nodes and no thresholds.                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Liveness_Init(ROS_APP_Liveness_t *Live, uint32 MidOffset)
+{
+    memset(Live, 0, sizeof(*Live));
+    memset(Live->Slots, 0xFF, sizeof(Live->Slots));
+    memset(Live->Wheel, 0xFF, sizeof(Live->Wheel));
+
+    Live->CurTick = (uint32)(ROS_APP_GetTimeUsec() / (ROS_APP_LIVENESS_TICK_MS * 1000));
+
+    CFE_MSG_Init(&Live->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_LIVENESS_TLM_MID + MidOffset),
+                 sizeof(Live->Tlm));
+
+} /* End of ROS_APP_Liveness_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_Configure                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Applies a newly loaded table.  Every timer is rebuilt so that a    */
+/*         shorter threshold takes effect at once, and listed nodes that      */
+/*         have not been heard from yet are watched from now.                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Liveness_Configure(ROS_APP_Liveness_t *Live, uint32 DefaultSilenceMs, const ROS_APP_NodeSilence_t *Nodes)
+{
+    ROS_APP_LivenessNode_t *Node;
+    uint16                  Index;
+    uint32                  i;
+
+    Live->DefaultSilenceTicks = ROS_APP_Liveness_MsToTicks(DefaultSilenceMs);
+    memcpy(Live->Rules, Nodes, sizeof(Live->Rules));
+
+    memset(Live->Wheel, 0xFF, sizeof(Live->Wheel));
+
+    for (i = 0; i < Live->NodeCount; i++)
+    {
+        Node               = &Live->Nodes[i];
+        Node->SilenceTicks = ROS_APP_Liveness_SilenceFor(Live, Node->Node);
+
+        if (Node->State == ROS_APP_LIVENESS_NODE_ARMED)
+        {
+            Node->State = ROS_APP_LIVENESS_NODE_IDLE;
+        }
+
+        ROS_APP_Liveness_Arm(Live, (uint16)i);
+    }
+
+    for (i = 0; i < ROS_APP_LIVENESS_TABLE_NODES; i++)
+    {
+        if (Nodes[i].Node[0] != 0 && Nodes[i].SilenceMs != 0)
+        {
+            Index = ROS_APP_Liveness_FindNode(Live, Nodes[i].Node);
+            if (Index != ROS_APP_LIVENESS_NONE)
+            {
+                ROS_APP_Liveness_Arm(Live, Index);
+            }
+        }
+    }
+
+} /* End of ROS_APP_Liveness_Configure() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_Touch                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Notes a record from a node.  Name is a /rosout name field and      */
+/*         need not be terminated.                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Liveness_Touch(ROS_APP_Liveness_t *Live, const char *Name)
+{
+    ROS_APP_LivenessNode_t *Node;
+    uint16                  Index;
+
+    Index = ROS_APP_Liveness_FindNode(Live, Name);
+    if (Index == ROS_APP_LIVENESS_NONE)
+    {
+        Live->Tlm.Payload.Untracked++;
+        return;
+    }
+
+    Node = &Live->Nodes[Index];
+
+    if (Node->State == ROS_APP_LIVENESS_NODE_SILENT)
+    {
+        Node->State = ROS_APP_LIVENESS_NODE_IDLE;
+        ROS_APP_Liveness_Report(Live, Node, ROS_APP_LIVENESS_ALIVE);
+    }
+
+    Node->LastSeen = Live->CurTick;
+
+    if (Node->State == ROS_APP_LIVENESS_NODE_IDLE)
+    {
+        ROS_APP_Liveness_Arm(Live, Index);
+    }
+
+} /* End of ROS_APP_Liveness_Touch() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_Advance                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Runs the wheel up to the current tick.  On each tick, higher       */
+/*         level slots that come due are moved down first, then the timers   */
+/*         in the level 0 slot run out.  After a stall at most                */
+/*         ROS_APP_LIVENESS_MAX_CATCHUP_TICKS are run per call.               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Liveness_Advance(ROS_APP_Liveness_t *Live)
+{
+    uint32 Now = (uint32)(ROS_APP_GetTimeUsec() / (ROS_APP_LIVENESS_TICK_MS * 1000));
+    uint32 Ticks;
+    uint32 Level;
+    uint32 Shift;
+    uint32 Slot;
+    uint16 Index;
+    uint16 Next;
+
+    for (Ticks = 0; Ticks < ROS_APP_LIVENESS_MAX_CATCHUP_TICKS && (int32)(Now - Live->CurTick) > 0; Ticks++)
+    {
+        Live->CurTick++;
+
+        for (Level = ROS_APP_LIVENESS_WHEEL_LEVELS - 1; Level > 0; Level--)
+        {
+            Shift = Level * ROS_APP_LIVENESS_WHEEL_BITS;
+            if ((Live->CurTick & ((1u << Shift) - 1)) != 0)
+            {
+                continue;
+            }
+
+            Slot  = (Live->CurTick >> Shift) & (ROS_APP_LIVENESS_WHEEL_SLOTS - 1);
+            Index = Live->Wheel[Level][Slot];
+            Live->Wheel[Level][Slot] = ROS_APP_LIVENESS_NONE;
+
+            while (Index != ROS_APP_LIVENESS_NONE)
+            {
+                Next = Live->Nodes[Index].Next;
+                ROS_APP_Liveness_Insert(Live, Index, Live->Nodes[Index].LastSeen + Live->Nodes[Index].SilenceTicks);
+                Index = Next;
+            }
+        }
+
+        Slot  = Live->CurTick & (ROS_APP_LIVENESS_WHEEL_SLOTS - 1);
+        Index = Live->Wheel[0][Slot];
+        Live->Wheel[0][Slot] = ROS_APP_LIVENESS_NONE;
+
+        while (Index != ROS_APP_LIVENESS_NONE)
+        {
+            Next = Live->Nodes[Index].Next;
+            ROS_APP_Liveness_Expire(Live, Index);
+            Index = Next;
+        }
+    }
+
+} /* End of ROS_APP_Liveness_Advance() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Liveness_ResetStats                                        */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the transition and overflow counts.                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Liveness_ResetStats(ROS_APP_Liveness_t *Live)
+{
+    Live->Tlm.Payload.Transitions = 0;
+    Live->Tlm.Payload.Untracked   = 0;
+
+} /* End of ROS_APP_Liveness_ResetStats() */
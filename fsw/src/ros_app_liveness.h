@@ -0,0 +1,109 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_liveness.h
+**
+** Purpose:
+**   Node liveness: reports ROS nodes that stop sending /rosout records.
+**
+** Notes:
+**   Each tracked node holds one timer in a hierarchical timer wheel of
+**   ROS_APP_LIVENESS_WHEEL_LEVELS levels, each of
+**   ROS_APP_LIVENESS_WHEEL_SLOTS slots, counted in ticks of
+**   ROS_APP_LIVENESS_TICK_MS.  A record only stores the tick it arrived
+**   on; the timer is not moved.  When a timer runs out, the node is
+**   re-armed from its newest record, or reported silent if it has been
+**   quiet for its whole threshold.  Records, timer expiry and each tick
+**   cost the same however many nodes are tracked, apart from the nodes
+**   whose timers are due.  Deadlines past the top level are parked in its
+**   last slot and re-armed from there.
+**
+**   A silent node is reported once, with an event and a liveness packet,
+**   and again when it is next heard from.
+**
+*******************************************************************************/
+#ifndef _ros_app_liveness_h_
+#define _ros_app_liveness_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_table.h"
+#include "ros_app_platform_cfg.h"
+
+#define ROS_APP_LIVENESS_WHEEL_BITS   6
+#define ROS_APP_LIVENESS_WHEEL_SLOTS  (1 << ROS_APP_LIVENESS_WHEEL_BITS)
+#define ROS_APP_LIVENESS_WHEEL_LEVELS 3
+#define ROS_APP_LIVENESS_NONE         0xFFFF
+
+/*
+** Node states
+*/
+#define ROS_APP_LIVENESS_NODE_IDLE   0 /* Not watched, no timer */
+#define ROS_APP_LIVENESS_NODE_ARMED  1 /* Timer in the wheel */
+#define ROS_APP_LIVENESS_NODE_SILENT 2 /* Reported silent, no timer */
+
+/*
+** One tracked node
+*/
+typedef struct
+{
+    uint32 NameHash;
+    uint32 LastSeen;     /* Tick of the newest record */
+    uint32 SilenceTicks; /* 0 when the node is not watched */
+    uint16 Next;         /* Next node in the same wheel slot */
+    uint8  State;
+    uint8  spare;
+    char   Node[ROS_APP_NODE_NAME_BYTES];
+
+} ROS_APP_LivenessNode_t;
+
+/*
+** Liveness state
+*/
+typedef struct
+{
+    uint32                DefaultSilenceTicks;
+    ROS_APP_NodeSilence_t Rules[ROS_APP_LIVENESS_TABLE_NODES];
+
+    ROS_APP_LivenessNode_t Nodes[ROS_APP_LIVENESS_MAX_NODES];
+    uint16                 Slots[ROS_APP_LIVENESS_HASH_SLOTS]; /* Index into Nodes, or ROS_APP_LIVENESS_NONE */
+    uint32                 NodeCount;
+
+    uint32 CurTick;
+    uint16 Wheel[ROS_APP_LIVENESS_WHEEL_LEVELS][ROS_APP_LIVENESS_WHEEL_SLOTS]; /* List heads */
+
+    ROS_APP_LivenessTlm_t Tlm;
+
+} ROS_APP_Liveness_t;
+
+/*
+** Exported functions
+*/
+void ROS_APP_Liveness_Init(ROS_APP_Liveness_t *Live, uint32 MidOffset);
+void ROS_APP_Liveness_Configure(ROS_APP_Liveness_t *Live, uint32 DefaultSilenceMs, const ROS_APP_NodeSilence_t *Nodes);
+void ROS_APP_Liveness_Touch(ROS_APP_Liveness_t *Live, const char *Name);
+void ROS_APP_Liveness_Advance(ROS_APP_Liveness_t *Live);
+void ROS_APP_Liveness_ResetStats(ROS_APP_Liveness_t *Live);
+
+#endif /* _ros_app_liveness_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,505 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_loadgen.c
+**
+** Purpose:
+**   Synthetic /rosout load generator and saturation sweep.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_events.h"
+#include "ros_app.h"
+#include "ros_app_loadgen.h"
+#include "ros_app_utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+** Message ID and rcl_interfaces/Log level for each generated severity
+*/
+static const CFE_SB_MsgId_Atom_t ROS_APP_LoadGenMids[ROS_APP_SEVERITY_COUNT] = {
+    ROS_APP_ROSOUT_DEBUG_MID, ROS_APP_ROSOUT_INFO_MID,  ROS_APP_ROSOUT_WARN_MID,
+    ROS_APP_ROSOUT_ERROR_MID, ROS_APP_ROSOUT_FATAL_MID,
+};
+
+static const uint8 ROS_APP_LoadGenLevels[ROS_APP_SEVERITY_COUNT] = {10, 20, 30, 40, 50};
+
+#define ROS_APP_LOADGEN_TOKEN 1000000 /* One message in a token bucket */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_LoadGen_Random                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         xorshift32, good enough to spread the message mix.                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static uint32 ROS_APP_LoadGen_Random(ROS_APP_LoadGen_t *LoadGen)
+{
+    uint32 x = LoadGen->RandomState;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+
+    LoadGen->RandomState = x;
+
+    return x;
+
+} /* End of ROS_APP_LoadGen_Random() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_LoadGen_SendOne                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Builds and publishes one synthetic /rosout message, unless the     */
+/*         flow control advice being followed holds its severity back.        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void ROS_APP_LoadGen_SendOne(ROS_APP_LoadGen_t *LoadGen, uint32 TotalWeight)
+{
+    ROS_APP_Rosout_Payload_t *Payload = &LoadGen->MsgBuf.Payload;
+    uint32                    Pick;
+    uint32                    Severity;
+    uint32                    Length;
+    uint32                    Span;
+    uint64                    Now;
+    int                       Used;
+
+    /*
+    ** Severity by weight, defaulting to INFO when no weights were given
+    */
+    Severity = 1;
+    if (TotalWeight > 0)
+    {
+        Pick = ROS_APP_LoadGen_Random(LoadGen) % TotalWeight;
+        for (Severity = 0; Severity < ROS_APP_SEVERITY_COUNT - 1; Severity++)
+        {
+            if (Pick < LoadGen->Config.SeverityWeights[Severity])
+            {
+                break;
+            }
+            Pick -= LoadGen->Config.SeverityWeights[Severity];
+        }
+    }
+
+    LoadGen->Offered++;
+
+    if (LoadGen->MaxMsgPerSec[Severity] != ROS_APP_FLOW_UNLIMITED)
+    {
+        if (LoadGen->Tokens[Severity] < ROS_APP_LOADGEN_TOKEN)
+        {
+            LoadGen->Tlm.Payload.TotalThrottled++;
+            return;
+        }
+
+        LoadGen->Tokens[Severity] -= ROS_APP_LOADGEN_TOKEN;
+    }
+
+    CFE_MSG_Init(&LoadGen->MsgBuf.TlmHeader.Msg,
+                 CFE_SB_ValueToMsgId(ROS_APP_LoadGenMids[Severity] + LoadGen->MidOffset), sizeof(LoadGen->MsgBuf));
+
+    Now           = ROS_APP_GetTimeUsec();
+    Payload->sec  = (uint32)(Now / 1000000);
+    Payload->nsec = (uint32)(Now % 1000000) * 1000;
+    Payload->level = ROS_APP_LoadGenLevels[Severity];
+    Payload->line  = LoadGen->Tlm.Payload.TotalSent;
+
+    snprintf(Payload->name, sizeof(Payload->name), "/loadgen_%lu",
+             (unsigned long)(ROS_APP_LoadGen_Random(LoadGen) % LoadGen->Config.NodeCount));
+
+    Span   = (uint32)LoadGen->Config.MaxMsgBytes - LoadGen->Config.MinMsgBytes + 1;
+    Length = LoadGen->Config.MinMsgBytes + (ROS_APP_LoadGen_Random(LoadGen) % Span);
+
+    Used = snprintf(Payload->msg, sizeof(Payload->msg), "synthetic load %lu ",
+                    (unsigned long)LoadGen->Tlm.Payload.TotalSent);
+    if (Used < 0)
+    {
+        Used = 0;
+    }
+    if (Length > (uint32)Used)
+    {
+        memset(&Payload->msg[Used], 'x', Length - Used);
+    }
+    Payload->msg[Length] = 0;
+
+    if (CFE_SB_TransmitMsg(&LoadGen->MsgBuf.TlmHeader.Msg, true) == CFE_SUCCESS)
+    {
+        LoadGen->Tlm.Payload.TotalSent++;
+    }
+    else
+    {
+        LoadGen->Tlm.Payload.SendErrors++;
+    }
+
+} /* End of ROS_APP_LoadGen_SendOne() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_LoadGen_FollowFlow                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Subscribes to the owning instance's flow control advice.  Until    */
+/*         advice arrives, and when not following it, nothing is limited.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void ROS_APP_LoadGen_FollowFlow(ROS_APP_LoadGen_t *LoadGen, uint8 Instance)
+{
+    char   PipeName[CFE_MISSION_MAX_API_LEN];
+    int32  status;
+    uint32 i;
+
+    for (i = 0; i < ROS_APP_SEVERITY_COUNT; i++)
+    {
+        LoadGen->MaxMsgPerSec[i] = ROS_APP_FLOW_UNLIMITED;
+    }
+
+    if (!LoadGen->Config.ObeyFlowCtl)
+    {
+        return;
+    }
+
+    ROS_APP_InstanceName(PipeName, sizeof(PipeName), "ROS_APP_LG_FLOW", Instance);
+
+    status = CFE_SB_CreatePipe(&LoadGen->FlowPipe, ROS_APP_LOADGEN_FLOW_PIPE_DEPTH, PipeName);
+    if (status == CFE_SUCCESS)
+    {
+        status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(ROS_APP_FLOW_CTL_MID + LoadGen->MidOffset), LoadGen->FlowPipe);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_SB_DeletePipe(LoadGen->FlowPipe);
+        }
+    }
+
+    if (status != CFE_SUCCESS)
+    {
+        LoadGen->Config.ObeyFlowCtl = false;
+
+        CFE_EVS_SendEvent(ROS_APP_LOADGEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: load gen cannot follow flow control, RC = 0x%08lX", (unsigned long)status);
+        return;
+    }
+
+    LoadGen->RefillUsec = ROS_APP_GetTimeUsec();
+
+} /* End of ROS_APP_LoadGen_FollowFlow() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_LoadGen_UpdateFlow                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes the newest flow control advice and refills the buckets.      */
+/*         A bucket holds at most one slice worth of its rate, and at least   */
+/*         one message.                                                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static void ROS_APP_LoadGen_UpdateFlow(ROS_APP_LoadGen_t *LoadGen)
+{
+    CFE_SB_Buffer_t                 *SBBufPtr;
+    const ROS_APP_FlowCtl_Payload_t *Advice;
+    CFE_MSG_Size_t                   MsgSize;
+    uint64                           Now;
+    uint64                           Elapsed;
+    uint64                           Cap;
+    uint32                           i;
+
+    while (CFE_SB_ReceiveBuffer(&SBBufPtr, LoadGen->FlowPipe, CFE_SB_POLL) == CFE_SUCCESS)
+    {
+        MsgSize = 0;
+        CFE_MSG_GetSize(&SBBufPtr->Msg, &MsgSize);
+        if (MsgSize == sizeof(ROS_APP_FlowCtlTlm_t))
+        {
+            Advice = &((const ROS_APP_FlowCtlTlm_t *)SBBufPtr)->Payload;
+            memcpy(LoadGen->MaxMsgPerSec, Advice->MaxMsgPerSec, sizeof(LoadGen->MaxMsgPerSec));
+        }
+    }
+
+    Now     = ROS_APP_GetTimeUsec();
+    Elapsed = Now - LoadGen->RefillUsec;
+
+    LoadGen->RefillUsec = Now;
+
+    for (i = 0; i < ROS_APP_SEVERITY_COUNT; i++)
+    {
+        if (LoadGen->MaxMsgPerSec[i] == ROS_APP_FLOW_UNLIMITED)
+        {
+            continue;
+        }
+
+        Cap = (uint64)LoadGen->MaxMsgPerSec[i] * ROS_APP_LOADGEN_SLICE_MS * 1000;
+        if (Cap < ROS_APP_LOADGEN_TOKEN)
+        {
+            Cap = ROS_APP_LOADGEN_TOKEN;
+        }
+
+        LoadGen->Tokens[i] += Elapsed * LoadGen->MaxMsgPerSec[i];
+        if (LoadGen->Tokens[i] > Cap)
+        {
+            LoadGen->Tokens[i] = Cap;
+        }
+    }
+
+} /* End of ROS_APP_LoadGen_UpdateFlow() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_LoadGen_Init                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Resets the load generator state and its telemetry packet.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_LoadGen_Init(ROS_APP_LoadGen_t *LoadGen, uint32 MidOffset)
+{
+    memset(LoadGen, 0, sizeof(*LoadGen));
+
+    LoadGen->State     = ROS_APP_LOADGEN_STATE_IDLE;
+    LoadGen->MidOffset = MidOffset;
+
+    CFE_MSG_Init(&LoadGen->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_LOADGEN_TLM_MID + MidOffset),
+                 sizeof(LoadGen->Tlm));
+
+    /*
+    ** The synthetic file/function fields never change
+    */
+    strncpy(LoadGen->MsgBuf.Payload.file, "ros_app_loadgen.c", sizeof(LoadGen->MsgBuf.Payload.file) - 1);
+    strncpy(LoadGen->MsgBuf.Payload.function, "ROS_APP_LoadGenTask", sizeof(LoadGen->MsgBuf.Payload.function) - 1);
+
+} /* End of ROS_APP_LoadGen_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_LoadGenTask                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Child task entry point.  Runs one step per rate, measuring what    */
+/*         ros_app processed and how busy it was, and reports each step in    */
+/*         ROS_APP_LOADGEN_TLM_MID.                                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_LoadGenTask(void)
+{
+    ROS_APP_Data_t               *Data    = ROS_APP_ChildTaskData();
+    ROS_APP_LoadGen_t            *LoadGen = &Data->LoadGen;
+    ROS_APP_LoadGenTlm_Payload_t *Result  = &LoadGen->Tlm.Payload;
+    uint32                        TotalWeight = 0;
+    uint32                        Rate;
+    uint32                        Offered0;
+    uint32                        Throttled0;
+    uint32                        Sent0;
+    uint32                        Processed0;
+    uint32                        Lost;
+    uint64                        Busy0;
+    uint64                        Start;
+    uint64                        Elapsed;
+    uint64                        Target;
+    uint32                        i;
+
+    for (i = 0; i < ROS_APP_SEVERITY_COUNT; i++)
+    {
+        TotalWeight += LoadGen->Config.SeverityWeights[i];
+    }
+
+    Rate = LoadGen->Config.RateMsgPerSec;
+
+    ROS_APP_LoadGen_FollowFlow(LoadGen, Data->Instance);
+
+    while (!LoadGen->StopRequested)
+    {
+        Offered0   = LoadGen->Offered;
+        Throttled0 = Result->TotalThrottled;
+        Sent0      = Result->TotalSent;
+        Processed0 = Data->RosoutMsgCount;
+        Busy0      = Data->BusyUsec;
+        Start      = ROS_APP_GetTimeUsec();
+
+        /*
+        ** Offer Rate msg/s for one step, catching up once per slice
+        */
+        do
+        {
+            Elapsed = ROS_APP_GetTimeUsec() - Start;
+            Target  = ((uint64)Rate * Elapsed) / 1000000;
+
+            if (LoadGen->Config.ObeyFlowCtl)
+            {
+                ROS_APP_LoadGen_UpdateFlow(LoadGen);
+            }
+
+            while ((LoadGen->Offered - Offered0) < Target && !LoadGen->StopRequested)
+            {
+                ROS_APP_LoadGen_SendOne(LoadGen, TotalWeight);
+            }
+
+            OS_TaskDelay(ROS_APP_LOADGEN_SLICE_MS);
+
+        } while (Elapsed < ((uint64)LoadGen->Config.StepDurationMs * 1000) && !LoadGen->StopRequested);
+
+        OS_TaskDelay(ROS_APP_LOADGEN_SETTLE_MS);
+
+        Elapsed = ROS_APP_GetTimeUsec() - Start;
+
+        Result->StepRateMsgPerSec = Rate;
+        Result->StepSent          = Result->TotalSent - Sent0;
+        Result->StepThrottled     = Result->TotalThrottled - Throttled0;
+        Result->StepProcessed     = Data->RosoutMsgCount - Processed0;
+        Result->StepCpuPermille   = (uint32)(((Data->BusyUsec - Busy0) * 1000) / Elapsed);
+
+        Lost                = (Result->StepSent > Result->StepProcessed) ? (Result->StepSent - Result->StepProcessed) : 0;
+        Result->StepDropPpm = (Result->StepSent > 0) ? (uint32)(((uint64)Lost * 1000000) / Result->StepSent) : 0;
+
+        if (Result->StepDropPpm > LoadGen->Config.DropThresholdPpm)
+        {
+            if (!Result->KneeFound)
+            {
+                Result->KneeFound         = true;
+                Result->KneeRateMsgPerSec = Rate;
+                Result->KneeCpuPermille   = Result->StepCpuPermille;
+            }
+        }
+        else if (Result->StepProcessed > 0)
+        {
+            /* Processed rate over the step's offered time */
+            Target = ((uint64)Result->StepProcessed * 1000) / LoadGen->Config.StepDurationMs;
+            if (Target > Result->SustainableMsgPerSec)
+            {
+                Result->SustainableMsgPerSec = (uint32)Target;
+            }
+        }
+
+        CFE_SB_TimeStampMsg(&LoadGen->Tlm.TlmHeader.Msg);
+        CFE_SB_TransmitMsg(&LoadGen->Tlm.TlmHeader.Msg, true);
+
+        Result->Step++;
+
+        if (LoadGen->Config.SweepStepMsgPerSec == 0 || Result->KneeFound)
+        {
+            break;
+        }
+
+        Rate += LoadGen->Config.SweepStepMsgPerSec;
+        if (Rate > LoadGen->Config.MaxRateMsgPerSec)
+        {
+            break;
+        }
+    }
+
+    if (LoadGen->Config.ObeyFlowCtl)
+    {
+        CFE_SB_DeletePipe(LoadGen->FlowPipe);
+    }
+
+    LoadGen->State = ROS_APP_LOADGEN_STATE_IDLE;
+    Result->State  = ROS_APP_LOADGEN_STATE_IDLE;
+
+    CFE_EVS_SendEvent(ROS_APP_LOADGEN_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "ros: load gen done, sustainable %lu msg/s, knee %lu msg/s at %lu/1000 CPU, pipe depth %u",
+                      (unsigned long)Result->SustainableMsgPerSec, (unsigned long)Result->KneeRateMsgPerSec,
+                      (unsigned long)Result->KneeCpuPermille, (unsigned int)Result->PipeDepth);
+
+    CFE_ES_ExitChildTask();
+
+} /* End of ROS_APP_LoadGenTask() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_StartLoadGen -- Start a fixed-rate run or a saturation sweep       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_StartLoadGen(ROS_APP_Data_t *Data, const ROS_APP_StartLoadGenCmd_t *Msg)
+{
+    ROS_APP_LoadGen_t                    *LoadGen = &Data->LoadGen;
+    const ROS_APP_StartLoadGen_Payload_t *Cfg     = &Msg->Payload;
+    int32                                 status;
+
+    if (LoadGen->State != ROS_APP_LOADGEN_STATE_IDLE)
+    {
+        CFE_EVS_SendEvent(ROS_APP_LOADGEN_ERR_EID, CFE_EVS_EventType_ERROR, "ros: load gen already running");
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    if (Cfg->RateMsgPerSec == 0 || Cfg->StepDurationMs == 0 || Cfg->NodeCount == 0 ||
+        Cfg->MinMsgBytes > Cfg->MaxMsgBytes || Cfg->MaxMsgBytes >= ROS_APP_ROSOUT_TLM_MSG_BYTES)
+    {
+        CFE_EVS_SendEvent(ROS_APP_LOADGEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: invalid load gen config, rate=%lu step=%lu ms nodes=%u len=%u..%u",
+                          (unsigned long)Cfg->RateMsgPerSec, (unsigned long)Cfg->StepDurationMs,
+                          (unsigned int)Cfg->NodeCount, (unsigned int)Cfg->MinMsgBytes,
+                          (unsigned int)Cfg->MaxMsgBytes);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    LoadGen->Config        = *Cfg;
+    LoadGen->StopRequested = false;
+    LoadGen->RandomState   = 0x2545F491;
+    LoadGen->State         = ROS_APP_LOADGEN_STATE_RUNNING;
+
+    memset(&LoadGen->Tlm.Payload, 0, sizeof(LoadGen->Tlm.Payload));
+    LoadGen->Tlm.Payload.State     = ROS_APP_LOADGEN_STATE_RUNNING;
+    LoadGen->Tlm.Payload.PipeDepth = Data->PipeDepth;
+
+    status = ROS_APP_CreateChildTask(Data, &LoadGen->TaskId, ROS_APP_LOADGEN_TASK_NAME, ROS_APP_LoadGenTask,
+                                     ROS_APP_LOADGEN_STACK_SIZE, ROS_APP_LOADGEN_PRIORITY);
+    if (status != CFE_SUCCESS)
+    {
+        LoadGen->State = ROS_APP_LOADGEN_STATE_IDLE;
+
+        CFE_EVS_SendEvent(ROS_APP_LOADGEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: unable to create load gen task, RC = 0x%08lX", (unsigned long)status);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    Data->CmdCounter++;
+
+    CFE_EVS_SendEvent(ROS_APP_LOADGEN_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "ros: load gen started at %lu msg/s, step %lu msg/s every %lu ms%s",
+                      (unsigned long)Cfg->RateMsgPerSec, (unsigned long)Cfg->SweepStepMsgPerSec,
+                      (unsigned long)Cfg->StepDurationMs, Cfg->ObeyFlowCtl ? ", following flow control" : "");
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_StartLoadGen() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_StopLoadGen -- Ask the load generator to stop after this step      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_StopLoadGen(ROS_APP_Data_t *Data, const ROS_APP_StopLoadGenCmd_t *Msg)
+{
+    if (Data->LoadGen.State != ROS_APP_LOADGEN_STATE_RUNNING)
+    {
+        CFE_EVS_SendEvent(ROS_APP_LOADGEN_ERR_EID, CFE_EVS_EventType_ERROR, "ros: load gen not running");
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    Data->LoadGen.StopRequested = true;
+    Data->CmdCounter++;
+
+    CFE_EVS_SendEvent(ROS_APP_LOADGEN_INF_EID, CFE_EVS_EventType_INFORMATION, "ros: load gen stop requested");
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_StopLoadGen() */
@@ -0,0 +1,82 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_loadgen.h
+**
+** Purpose:
+**   Synthetic /rosout load generator and saturation sweep.
+**
+** Notes:
+**   The generator runs as a child task and publishes on the same
+**   ROS_APP_ROSOUT_*_MID message IDs as the ROS bridge, so everything
+**   downstream of the pipe sees ordinary traffic.  Losses are measured as
+**   messages sent minus messages ros_app processed in the same step, so a
+**   sweep should be run with the real bridge disconnected.
+**
+**   With ObeyFlowCtl the generator also stands in for a bridge that
+**   follows ros_app's flow control advice: it subscribes to
+**   ROS_APP_FLOW_CTL_MID and holds each severity to its recommended rate
+**   with a token bucket, counting what it held back as throttled.
+**
+*******************************************************************************/
+#ifndef _ros_app_loadgen_h_
+#define _ros_app_loadgen_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+
+/*
+** Load generator state, shared between the main task and the child task
+*/
+typedef struct
+{
+    volatile uint8  State;
+    volatile bool   StopRequested;
+    CFE_ES_TaskId_t TaskId;
+    uint32          RandomState;
+    uint32          MidOffset; /* Of the owning instance */
+    uint32          Offered;   /* Messages generated, sent or throttled */
+
+    /*
+    ** Flow control advice being followed.  Tokens are in millionths of a
+    ** message.
+    */
+    CFE_SB_PipeId_t FlowPipe;
+    uint32          MaxMsgPerSec[ROS_APP_SEVERITY_COUNT];
+    uint64          Tokens[ROS_APP_SEVERITY_COUNT];
+    uint64          RefillUsec;
+
+    ROS_APP_StartLoadGen_Payload_t Config;
+    ROS_APP_LoadGenTlm_t           Tlm;
+    ROS_APP_RosoutTlm_t            MsgBuf;
+
+} ROS_APP_LoadGen_t;
+
+/*
+** Exported functions
+*/
+void  ROS_APP_LoadGen_Init(ROS_APP_LoadGen_t *LoadGen, uint32 MidOffset);
+void  ROS_APP_LoadGenTask(void);
+
+#endif /* _ros_app_loadgen_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,194 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_lvc.c
+**
+** Purpose:
+**   Last-value cache: the newest /rosout record of each severity from
+**   each node.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_lvc.h"
+#include "ros_app_utils.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if ROS_APP_LVC_HASH_SLOTS < 2 * ROS_APP_LVC_MAX_NODES || ROS_APP_LVC_MAX_NODES >= ROS_APP_LVC_NO_NODE
+#error ROS_APP_LVC_HASH_SLOTS must be at least twice ROS_APP_LVC_MAX_NODES
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Lvc_FindNode                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the cache entry for a node, adding it if there is room,    */
+/*         or NULL once the cache is full.                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static ROS_APP_LvcNode_t *ROS_APP_Lvc_FindNode(ROS_APP_Lvc_t *Lvc, const char *Name)
+{
+    ROS_APP_LvcNode_t *Node;
+    uint32             Hash;
+    uint32             Slot;
+    uint32             Probe;
+    uint8              Index;
+
+    Hash = ROS_APP_HashName(Name, ROS_APP_NODE_NAME_BYTES - 1);
+    Slot = Hash & (ROS_APP_LVC_HASH_SLOTS - 1);
+
+    for (Probe = 0; Probe < ROS_APP_LVC_HASH_SLOTS; Probe++)
+    {
+        Index = Lvc->Slots[Slot];
+
+        if (Index == ROS_APP_LVC_NO_NODE)
+        {
+            if (Lvc->NodeCount >= ROS_APP_LVC_MAX_NODES)
+            {
+                return NULL;
+            }
+
+            Index = (uint8)Lvc->NodeCount++;
+            Node  = &Lvc->Nodes[Index];
+
+            Lvc->Slots[Slot]   = Index;
+            Lvc->Hashes[Index] = Hash;
+            strncpy(Node->Node, Name, sizeof(Node->Node) - 1);
+
+            return Node;
+        }
+
+        Node = &Lvc->Nodes[Index];
+        if (Lvc->Hashes[Index] == Hash && strncmp(Node->Node, Name, sizeof(Node->Node) - 1) == 0)
+        {
+            return Node;
+        }
+
+        Slot = (Slot + 1) & (ROS_APP_LVC_HASH_SLOTS - 1);
+    }
+
+    return NULL;
+
+} /* End of ROS_APP_Lvc_FindNode() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Lvc_Init                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Empties the cache.                                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Lvc_Init(ROS_APP_Lvc_t *Lvc, uint32 MidOffset)
+{
+    memset(Lvc, 0, sizeof(*Lvc));
+    memset(Lvc->Slots, ROS_APP_LVC_NO_NODE, sizeof(Lvc->Slots));
+
+    CFE_MSG_Init(&Lvc->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_LVC_TLM_MID + MidOffset), sizeof(Lvc->Tlm));
+
+} /* End of ROS_APP_Lvc_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Lvc_Update                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Makes a sanitized record the newest of its severity for its node.  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Lvc_Update(ROS_APP_Lvc_t *Lvc, uint8 Severity, const char *Name, uint32 Sec, uint32 Nsec,
+                        const char *Text, uint32 TextBytes)
+{
+    ROS_APP_LvcNode_t  *Node = ROS_APP_Lvc_FindNode(Lvc, Name);
+    ROS_APP_LvcEntry_t *Entry;
+
+    if (Node == NULL)
+    {
+        Lvc->Uncached++;
+        return;
+    }
+
+    Entry       = &Node->Last[Severity];
+    Entry->sec  = Sec;
+    Entry->nsec = Nsec;
+    Entry->Count++;
+
+    if (TextBytes > sizeof(Entry->msg))
+    {
+        TextBytes = sizeof(Entry->msg);
+    }
+    memcpy(Entry->msg, Text, TextBytes);
+    Entry->msg[TextBytes - 1] = 0;
+
+} /* End of ROS_APP_Lvc_Update() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Lvc_Dump                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the whole cache and returns the number of packets.  An       */
+/*         empty cache is sent as one packet with no nodes.                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint32 ROS_APP_Lvc_Dump(ROS_APP_Lvc_t *Lvc)
+{
+    ROS_APP_LvcTlm_Payload_t *Payload = &Lvc->Tlm.Payload;
+    uint32                    Packets;
+    uint32                    Packet;
+    uint32                    First;
+    uint32                    Count;
+
+    Packets = (Lvc->NodeCount + ROS_APP_LVC_NODES_PER_PKT - 1) / ROS_APP_LVC_NODES_PER_PKT;
+    if (Packets == 0)
+    {
+        Packets = 1;
+    }
+
+    Lvc->DumpSeq++;
+
+    for (Packet = 0; Packet < Packets; Packet++)
+    {
+        First = Packet * ROS_APP_LVC_NODES_PER_PKT;
+        Count = Lvc->NodeCount - First;
+        if (Count > ROS_APP_LVC_NODES_PER_PKT)
+        {
+            Count = ROS_APP_LVC_NODES_PER_PKT;
+        }
+
+        Payload->DumpSeq   = Lvc->DumpSeq;
+        Payload->Packet    = (uint16)Packet;
+        Payload->Packets   = (uint16)Packets;
+        Payload->NodeCount = (uint16)Lvc->NodeCount;
+        Payload->NodesHere = (uint16)Count;
+        Payload->Uncached  = Lvc->Uncached;
+        memcpy(Payload->Nodes, &Lvc->Nodes[First], Count * sizeof(Payload->Nodes[0]));
+
+        CFE_MSG_SetSize(&Lvc->Tlm.TlmHeader.Msg,
+                        offsetof(ROS_APP_LvcTlm_t, Payload.Nodes) + Count * sizeof(Payload->Nodes[0]));
+        CFE_SB_TimeStampMsg(&Lvc->Tlm.TlmHeader.Msg);
+        CFE_SB_TransmitMsg(&Lvc->Tlm.TlmHeader.Msg, true);
+    }
+
+    return Packets;
+
+} /* End of ROS_APP_Lvc_Dump() */
@@ -0,0 +1,73 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_lvc.h
+**
+** Purpose:
+**   Last-value cache: the newest /rosout record of each severity from
+**   each node.
+**
+** Notes:
+**   Nodes are added on first sight through an open-addressing hash on the
+**   node name and are never evicted; records from nodes that arrive once
+**   the cache is full are only counted.  An update is one hash probe and
+**   one bounded copy.  A dump sends every cached node,
+**   ROS_APP_LVC_NODES_PER_PKT to a packet, in the order they were first
+**   seen.
+**
+*******************************************************************************/
+#ifndef _ros_app_lvc_h_
+#define _ros_app_lvc_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+
+#define ROS_APP_LVC_NO_NODE 0xFF
+
+/*
+** Cache state
+*/
+typedef struct
+{
+    ROS_APP_LvcNode_t Nodes[ROS_APP_LVC_MAX_NODES];
+    uint32            Hashes[ROS_APP_LVC_MAX_NODES];
+    uint8             Slots[ROS_APP_LVC_HASH_SLOTS]; /* Index into Nodes, or ROS_APP_LVC_NO_NODE */
+    uint32            NodeCount;
+    uint32            Uncached;
+    uint32            DumpSeq;
+
+    ROS_APP_LvcTlm_t Tlm;
+
+} ROS_APP_Lvc_t;
+
+/*
+** Exported functions
+*/
+void   ROS_APP_Lvc_Init(ROS_APP_Lvc_t *Lvc, uint32 MidOffset);
+void   ROS_APP_Lvc_Update(ROS_APP_Lvc_t *Lvc, uint8 Severity, const char *Name, uint32 Sec, uint32 Nsec,
+                          const char *Text, uint32 TextBytes);
+uint32 ROS_APP_Lvc_Dump(ROS_APP_Lvc_t *Lvc);
+
+#endif /* _ros_app_lvc_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
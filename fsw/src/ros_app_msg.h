@@ -30,6 +30,8 @@
 #ifndef _ros_app_msg_h_
 #define _ros_app_msg_h_
 
+#include "ros_app_mission_cfg.h"
+
 /*
 ** ros App command codes
 */
@@ -39,6 +41,19 @@
 #define ROS_APP_RESET_COUNTERS_CC 1
 #define ROS_APP_PROCESS_CC		  2
 #define ROS_APP_HELLO_WORLD_CC	  0
+#define ROS_APP_START_CAPTURE_CC  4
+#define ROS_APP_STOP_CAPTURE_CC   5
+#define ROS_APP_START_REPLAY_CC   6
+#define ROS_APP_STOP_REPLAY_CC    7
+#define ROS_APP_START_LOADGEN_CC  8
+#define ROS_APP_STOP_LOADGEN_CC   9
+#define ROS_APP_SEND_PERF_CC      10
+#define ROS_APP_RESET_PERF_CC     11
+#define ROS_APP_DUMP_RECORDER_CC  12
+#define ROS_APP_START_EXPORT_CC   13
+#define ROS_APP_STOP_EXPORT_CC    14
+#define ROS_APP_SET_ROLLUP_CC     15
+#define ROS_APP_DUMP_LVC_CC       16
 
 /*************************************************************************/
 
@@ -60,6 +75,122 @@ typedef struct
 typedef ROS_APP_NoArgsCmd_t ROS_APP_NoopCmd_t;
 typedef ROS_APP_NoArgsCmd_t ROS_APP_ResetCountersCmd_t;
 typedef ROS_APP_NoArgsCmd_t ROS_APP_ProcessCmd_t;
+typedef ROS_APP_NoArgsCmd_t ROS_APP_StopCaptureCmd_t;
+typedef ROS_APP_NoArgsCmd_t ROS_APP_StopReplayCmd_t;
+typedef ROS_APP_NoArgsCmd_t ROS_APP_StopLoadGenCmd_t;
+typedef ROS_APP_NoArgsCmd_t ROS_APP_SendPerfCmd_t;
+typedef ROS_APP_NoArgsCmd_t ROS_APP_ResetPerfCmd_t;
+typedef ROS_APP_NoArgsCmd_t ROS_APP_DumpRecorderCmd_t;
+typedef ROS_APP_NoArgsCmd_t ROS_APP_StopExportCmd_t;
+typedef ROS_APP_NoArgsCmd_t ROS_APP_DumpLvcCmd_t;
+
+/*
+** Start capturing the /rosout stream to a file
+*/
+typedef struct
+{
+    char Filename[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Capture file to create */
+} ROS_APP_StartCapture_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t        CmdHeader; /**< \brief Command header */
+    ROS_APP_StartCapture_Payload_t Payload;   /**< \brief Command payload */
+} ROS_APP_StartCaptureCmd_t;
+
+/*
+** Replay a capture file onto the software bus
+**
+** RateMultiplier scales the recorded inter-arrival times: 1 replays in real
+** time, N replays N times faster and 0 replays as fast as possible.
+*/
+typedef struct
+{
+    char   Filename[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Capture file to replay */
+    uint16 RateMultiplier;                     /**< \brief 0 = as fast as possible, N = Nx real time */
+    uint8  spare[2];
+} ROS_APP_StartReplay_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t       CmdHeader; /**< \brief Command header */
+    ROS_APP_StartReplay_Payload_t Payload;   /**< \brief Command payload */
+} ROS_APP_StartReplayCmd_t;
+
+/*
+** Start the synthetic /rosout load generator
+**
+** With SweepStepMsgPerSec of zero the generator runs at RateMsgPerSec for
+** StepDurationMs.  Otherwise it raises the rate by SweepStepMsgPerSec every
+** StepDurationMs until more than DropThresholdPpm of a step's messages are
+** lost or MaxRateMsgPerSec is passed.  With ObeyFlowCtl set the generator
+** drops messages at the source to stay within ros_app's flow control
+** advice, the way a well-behaved bridge would.
+*/
+typedef struct
+{
+    uint32 RateMsgPerSec;                           /**< \brief Fixed rate, or first rate of a sweep */
+    uint32 SweepStepMsgPerSec;                      /**< \brief Rate increment per step, 0 = no sweep */
+    uint32 MaxRateMsgPerSec;                        /**< \brief Upper bound of the sweep */
+    uint32 StepDurationMs;                          /**< \brief Time spent at each rate */
+    uint32 DropThresholdPpm;                        /**< \brief Losses per million that mark the knee */
+    uint16 MinMsgBytes;                             /**< \brief Shortest generated msg text */
+    uint16 MaxMsgBytes;                             /**< \brief Longest generated msg text */
+    uint16 NodeCount;                               /**< \brief Number of distinct node names */
+    uint8  SeverityWeights[ROS_APP_SEVERITY_COUNT]; /**< \brief Relative mix, DEBUG through FATAL */
+    uint8  ObeyFlowCtl;                             /**< \brief Follow ROS_APP_FLOW_CTL_MID like a bridge would */
+} ROS_APP_StartLoadGen_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t        CmdHeader; /**< \brief Command header */
+    ROS_APP_StartLoadGen_Payload_t Payload;   /**< \brief Command payload */
+} ROS_APP_StartLoadGenCmd_t;
+
+/*
+** Export the records of a capture file to a CSV or binary file
+**
+** Only records whose ROS time stamp lies in [StartSec, EndSec) are
+** exported; an EndSec of zero leaves the range open.
+*/
+#define ROS_APP_EXPORT_FORMAT_CSV    0
+#define ROS_APP_EXPORT_FORMAT_BINARY 1
+
+typedef struct
+{
+    char   InFilename[CFE_MISSION_MAX_PATH_LEN];  /**< \brief Capture file to read */
+    char   OutFilename[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Export file to create */
+    uint32 StartSec;                              /**< \brief First ROS second to export */
+    uint32 EndSec;                                /**< \brief Exclusive end, 0 = open */
+    uint8  Format;                                /**< \brief ROS_APP_EXPORT_FORMAT_* */
+    uint8  spare[3];
+} ROS_APP_StartExport_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t       CmdHeader; /**< \brief Command header */
+    ROS_APP_StartExport_Payload_t Payload;   /**< \brief Command payload */
+} ROS_APP_StartExportCmd_t;
+
+/*
+** Switch between forwarding every record and sending one rollup summary
+** per interval.  Takes effect with the next record; switching back to
+** full forwarding sends the partial summary first.
+*/
+#define ROS_APP_ROLLUP_OFF 0
+#define ROS_APP_ROLLUP_ON  1
+
+typedef struct
+{
+    uint8 Mode; /**< \brief ROS_APP_ROLLUP_OFF or ROS_APP_ROLLUP_ON */
+    uint8 spare[3];
+} ROS_APP_SetRollup_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t     CmdHeader; /**< \brief Command header */
+    ROS_APP_SetRollup_Payload_t Payload;   /**< \brief Command payload */
+} ROS_APP_SetRollupCmd_t;
 
 /*************************************************************************/
 /*
@@ -70,7 +201,16 @@ typedef struct
 {
     uint8 CommandErrorCounter;
     uint8 CommandCounter;
-    uint8 spare[2];
+    uint8 Instance; /**< \brief Instance number, see ROS_APP_INSTANCE_COUNT */
+    uint8 RollupMode; /**< \brief ROS_APP_ROLLUP_ON while records are summarized */
+    uint32 RosoutMsgCount; /**< \brief /rosout packets processed */
+    uint32 ReasmCompleted; /**< \brief Fragmented messages reassembled */
+    uint32 ReasmTimeouts;  /**< \brief Partial messages discarded after ROS_APP_REASM_TIMEOUT_MS */
+    uint32 ReasmEvictions; /**< \brief Partial messages discarded to make room for a new one */
+    uint32 ReasmRejected;  /**< \brief Malformed or duplicate fragments */
+    uint32 SampledOut[ROS_APP_SEVERITY_COUNT]; /**< \brief Records not forwarded by sampling */
+    uint32 RosoutRejected; /**< \brief /rosout packets of the wrong size */
+    uint32 RosoutRepaired; /**< \brief Records with an unterminated field or control characters */
 } ROS_APP_HkTlm_Payload_t;
 
 typedef struct
@@ -106,6 +246,732 @@ typedef struct
     ROS_APP_Rosout_Payload_t Payload; /**< \brief Message format for rosout/ topic messages */
 } ROS_APP_RosoutTlm_t;
 
+/*
+** Fragmented /rosout messages
+**
+** The bridge splits a msg longer than ROS_APP_ROSOUT_TLM_MSG_BYTES into
+** FragCount packets on ROS_APP_ROSOUT_FRAG_MID.  Every fragment repeats the
+** record fields, so any fragment can open a reassembly slot, and carries
+** DataBytes of text in Record.msg.  Fragment N's text belongs at offset
+** N * ROS_APP_ROSOUT_FRAG_DATA_BYTES; only the last may be short.
+** MessageId only has to be unique per node while the fragments are in flight.
+*/
+#define ROS_APP_ROSOUT_FRAG_DATA_BYTES ROS_APP_ROSOUT_TLM_MSG_BYTES
+#define ROS_APP_ROSOUT_MAX_FRAGS       32
+#define ROS_APP_ROSOUT_LONG_MSG_BYTES  1024
+
+typedef struct
+{
+    uint32 MessageId; /**< \brief Bridge-assigned ID shared by all fragments of one msg */
+    uint16 FragIndex; /**< \brief 0 .. FragCount - 1 */
+    uint16 FragCount; /**< \brief Number of fragments, at most ROS_APP_ROSOUT_MAX_FRAGS */
+    uint16 DataBytes; /**< \brief Bytes of text carried in Record.msg */
+    uint8  spare[2];
+    ROS_APP_Rosout_Payload_t Record; /**< \brief Record fields; msg holds this fragment's text */
+} ROS_APP_RosoutFrag_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t    TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_RosoutFrag_Payload_t Payload;   /**< \brief Fragment payload */
+} ROS_APP_RosoutFragTlm_t;
+
+/*
+** A reassembled /rosout message.  msg_truncated is only set when the text
+** did not fit in ROS_APP_ROSOUT_LONG_MSG_BYTES.
+**
+** On the forwarded, templated and reassembled record packets the header
+** time is the record's ROS time converted to cFE time, once the clock
+** model is valid (see ROS_APP_ClockTlm_Payload_t), and the time the record
+** was queued before that.
+*/
+typedef struct
+{
+    uint32 sec;
+    uint32 nsec;
+    uint8 level;
+    bool name_truncated;
+    char name[ROS_APP_ROSOUT_TLM_NAME_BYTES];
+    bool msg_truncated;
+    char msg[ROS_APP_ROSOUT_LONG_MSG_BYTES];
+    bool file_truncated;
+    char file[ROS_APP_ROSOUT_TLM_FILE_BYTES];
+    bool function_truncated;
+    char function[ROS_APP_ROSOUT_TLM_FUNCTION_BYTES];
+    uint32 line;
+    uint16 SampleWeight; /**< \brief Records this one stands for, 1 when not sampled */
+} ROS_APP_RosoutLong_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t    TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_RosoutLong_Payload_t Payload;   /**< \brief Reassembled /rosout message */
+} ROS_APP_RosoutLongTlm_t;
+
+/*
+** A /rosout record forwarded for downlink on ROS_APP_ROSOUT_FWD_MID
+*/
+typedef struct
+{
+    uint8                    Severity;     /**< \brief ROS_APP_SEVERITY_* class the record was scheduled in */
+    uint8                    spare;
+    uint16                   SampleWeight; /**< \brief Records this one stands for, 1 when not sampled */
+    ROS_APP_Rosout_Payload_t Record;       /**< \brief The record as received from the bridge */
+} ROS_APP_RosoutFwd_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t   TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_RosoutFwd_Payload_t Payload;   /**< \brief Forwarded record */
+} ROS_APP_RosoutFwdTlm_t;
+
+/*
+** Templated /rosout records
+**
+** A record whose msg fits a known template is forwarded on
+** ROS_APP_ROSOUT_TMPL_MID with the template reference and packed
+** parameters in place of the text; the packet is cut off after Params.
+** Each template is announced once on ROS_APP_TMPL_DEF_MID, ahead of its
+** first use, and keeps its definition until Generation changes.
+*/
+#define ROS_APP_TMPL_MAX_PARAMS  16
+#define ROS_APP_TMPL_PARAM_BYTES (ROS_APP_ROSOUT_TLM_MSG_BYTES + ROS_APP_TMPL_MAX_PARAMS)
+
+typedef struct
+{
+    uint16 TemplateId; /**< \brief Slot in the template table */
+    uint16 Generation; /**< \brief Bumped each time the slot is reused */
+} ROS_APP_TmplRef_t;
+
+typedef struct
+{
+    ROS_APP_TmplRef_t Ref;                                 /**< \brief Template being defined */
+    uint16            TextBytes;                           /**< \brief Bytes of Text in use */
+    uint8             ParamCount;                          /**< \brief Slots in Text */
+    uint8             spare;
+    char              Text[ROS_APP_ROSOUT_TLM_MSG_BYTES];  /**< \brief Template, 0x1A marks a slot */
+} ROS_APP_TmplDef_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_TmplDef_Payload_t Payload;   /**< \brief Template definition */
+} ROS_APP_TmplDefTlm_t;
+
+typedef struct
+{
+    uint8             Severity;     /**< \brief ROS_APP_SEVERITY_* class the record was scheduled in */
+    uint8             spare;
+    uint16            SampleWeight; /**< \brief Records this one stands for, 1 when not sampled */
+    uint32            sec;
+    uint32            nsec;
+    uint8             level;
+    bool              name_truncated;
+    bool              msg_truncated;
+    bool              file_truncated;
+    bool              function_truncated;
+    uint8             spare2[3];
+    char              name[ROS_APP_ROSOUT_TLM_NAME_BYTES];
+    char              file[ROS_APP_ROSOUT_TLM_FILE_BYTES];
+    char              function[ROS_APP_ROSOUT_TLM_FUNCTION_BYTES];
+    uint32            line;
+    ROS_APP_TmplRef_t Ref;                               /**< \brief Template the msg was built from */
+    uint16            ParamBytes;                        /**< \brief Bytes of Params in use */
+    uint8             spare3[2];
+    uint8             Params[ROS_APP_TMPL_PARAM_BYTES];  /**< \brief Packed parameters, see ros_app_tmpl.h */
+} ROS_APP_RosoutTmpl_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t    TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_RosoutTmpl_Payload_t Payload;   /**< \brief Templated record */
+} ROS_APP_RosoutTmplTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App replay statistics)
+*/
+#define ROS_APP_CAPTURE_STATE_IDLE   0
+#define ROS_APP_CAPTURE_STATE_ACTIVE 1
+
+#define ROS_APP_REPLAY_STATE_IDLE     0
+#define ROS_APP_REPLAY_STATE_RUNNING  1
+#define ROS_APP_REPLAY_STATE_DRAINING 2
+
+typedef struct
+{
+    uint8  CaptureState;        /**< \brief ROS_APP_CAPTURE_STATE_* */
+    uint8  ReplayState;         /**< \brief ROS_APP_REPLAY_STATE_* */
+    uint16 RateMultiplier;      /**< \brief Rate of the current or last replay, 0 = as fast as possible */
+    uint32 CaptureCount;        /**< \brief Messages written to the capture file */
+    uint32 CaptureErrors;       /**< \brief Capture file write failures */
+    uint32 TxCount;             /**< \brief Messages sent by the replay task */
+    uint32 TxErrors;            /**< \brief Replay send failures and bad capture records */
+    uint32 RxCount;             /**< \brief /rosout messages processed by ros_app during the replay */
+    uint32 DropCount;           /**< \brief TxCount - RxCount once the replay has drained */
+    uint32 ElapsedMs;           /**< \brief First send to last receipt */
+    uint32 ThroughputMsgPerSec; /**< \brief RxCount / ElapsedMs */
+    uint32 LatencyAvgUsec;      /**< \brief Mean header time to processing time */
+    uint32 LatencyMaxUsec;      /**< \brief Worst header time to processing time */
+} ROS_APP_ReplayTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t   TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_ReplayTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_ReplayTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App load generator / saturation sweep results)
+*/
+#define ROS_APP_LOADGEN_STATE_IDLE    0
+#define ROS_APP_LOADGEN_STATE_RUNNING 1
+
+typedef struct
+{
+    uint8  State;                /**< \brief ROS_APP_LOADGEN_STATE_* */
+    uint8  KneeFound;            /**< \brief Set once a step exceeded the drop threshold */
+    uint16 PipeDepth;            /**< \brief ROS_APP_PIPE_DEPTH the results were measured with */
+    uint32 Step;                 /**< \brief Index of the last completed step */
+    uint32 TotalSent;            /**< \brief Messages sent since the start command */
+    uint32 SendErrors;           /**< \brief CFE_SB_TransmitMsg failures */
+    uint32 StepRateMsgPerSec;    /**< \brief Offered rate of the last step */
+    uint32 StepSent;             /**< \brief Messages sent in the last step */
+    uint32 StepProcessed;        /**< \brief Messages ros_app processed in the last step */
+    uint32 StepDropPpm;          /**< \brief Losses per million in the last step */
+    uint32 StepCpuPermille;      /**< \brief ros_app busy time per mille of the last step */
+    uint32 SustainableMsgPerSec; /**< \brief Best processed rate of a step below the threshold */
+    uint32 KneeRateMsgPerSec;    /**< \brief Offered rate of the first step over the threshold */
+    uint32 KneeCpuPermille;      /**< \brief ros_app busy time at the knee */
+    uint32 TotalThrottled;       /**< \brief Messages held back by flow control advice since the start command */
+    uint32 StepThrottled;        /**< \brief Messages held back by flow control advice in the last step */
+} ROS_APP_LoadGenTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t    TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_LoadGenTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_LoadGenTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App downlink scheduler)
+*/
+typedef struct
+{
+    uint32 QueuedPackets; /**< \brief Packets waiting in the class queue */
+    uint32 QueuedBytes;   /**< \brief Bytes waiting in the class queue */
+    uint32 Sent;          /**< \brief Packets sent for this class */
+    uint32 Dropped;       /**< \brief Packets dropped because the class queue was full */
+} ROS_APP_SchedClassTlm_t;
+
+typedef struct
+{
+    uint32                  BytesPerTick;  /**< \brief Configured budget */
+    uint32                  LastTickBytes; /**< \brief Bytes sent in the most recent tick */
+    uint32                  MaxTickBytes;  /**< \brief Most bytes sent in any tick since reset */
+    uint32                  Ticks;         /**< \brief Scheduler runs since reset */
+    ROS_APP_SchedClassTlm_t Class[ROS_APP_SEVERITY_COUNT]; /**< \brief Indexed by ROS_APP_SEVERITY_* */
+} ROS_APP_SchedTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t  TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_SchedTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_SchedTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App periodic task accounting)
+*/
+#define ROS_APP_TASK_NAME_BYTES   16
+#define ROS_APP_MAX_PERIODIC_TASKS 8
+
+typedef struct
+{
+    char   Name[ROS_APP_TASK_NAME_BYTES]; /**< \brief Task name, empty for unused slots */
+    uint32 PeriodMs;                      /**< \brief Configured period */
+    uint32 BudgetUsec;                    /**< \brief Time a single run is expected to stay under */
+    uint32 Runs;                          /**< \brief Runs since reset */
+    uint32 Overruns;                      /**< \brief Runs that exceeded BudgetUsec */
+    uint32 LastUsec;                      /**< \brief Duration of the latest run */
+    uint32 MaxUsec;                       /**< \brief Longest run since reset */
+    uint32 AvgUsec;                       /**< \brief Mean run time since reset */
+} ROS_APP_TaskTlm_t;
+
+typedef struct
+{
+    uint32            Wakeups;  /**< \brief ROS_APP_WAKEUP_MID packets received */
+    uint32            Timeouts; /**< \brief Pipe receives that timed out */
+    ROS_APP_TaskTlm_t Task[ROS_APP_MAX_PERIODIC_TASKS];
+} ROS_APP_TasksTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t  TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_TasksTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_TasksTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App per-stage execution time histograms)
+**
+** Bucket N counts runs that took [2^N, 2^(N+1)) nanoseconds; bucket 0 also
+** holds anything under 2 ns and the last bucket anything longer.
+*/
+#define ROS_APP_STAGE_DISPATCH 0
+#define ROS_APP_STAGE_ROSOUT   1
+#define ROS_APP_STAGE_FRAG     2
+#define ROS_APP_STAGE_CMD      3
+#define ROS_APP_STAGE_HK       4
+#define ROS_APP_STAGE_TBL      5
+#define ROS_APP_STAGE_TASKS    6
+#define ROS_APP_STAGE_EVS      7
+
+#define ROS_APP_STAGE_COUNT       8
+#define ROS_APP_PERF_HIST_BUCKETS 32
+
+typedef struct
+{
+    uint32 Count;                              /**< \brief Runs since reset */
+    uint32 TotalUsec;                          /**< \brief Summed run time */
+    uint32 MaxNsec;                            /**< \brief Longest run */
+    uint32 Buckets[ROS_APP_PERF_HIST_BUCKETS]; /**< \brief log2(nsec) histogram */
+} ROS_APP_PerfStageTlm_t;
+
+typedef struct
+{
+    ROS_APP_PerfStageTlm_t Stage[ROS_APP_STAGE_COUNT]; /**< \brief Indexed by ROS_APP_STAGE_* */
+} ROS_APP_PerfTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_PerfTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_PerfTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App alert patterns)
+*/
+typedef struct
+{
+    uint32 RecordsScanned;                    /**< \brief Records run through the matcher */
+    uint32 Matches;                           /**< \brief Pattern hits that passed their qualifiers */
+    uint32 EventsSent;                        /**< \brief Alert events raised */
+    uint32 EventsThrottled;                   /**< \brief Hits inside a pattern's event holdoff */
+    uint16 PatternCount;                      /**< \brief Patterns in the loaded table */
+    uint16 StateCount;                        /**< \brief States in the compiled automaton */
+    uint32 Hits[ROS_APP_ALERT_MAX_PATTERNS];  /**< \brief Indexed by alert table entry */
+} ROS_APP_AlertTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t  TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_AlertTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_AlertTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App template extraction)
+*/
+typedef struct
+{
+    uint32 Records;          /**< \brief Records offered to the extractor */
+    uint32 Encoded;          /**< \brief Records reduced to a template and parameters */
+    uint32 Hits;             /**< \brief Encoded records whose template was already known */
+    uint32 NewTemplates;     /**< \brief Templates added to the table */
+    uint32 Evictions;        /**< \brief Templates pushed out of a full table */
+    uint32 Untemplatable;    /**< \brief Records with too many parameters or a slot marker in the text */
+    uint16 TemplatesInUse;   /**< \brief Occupied table slots */
+    uint16 HitRatePermille;  /**< \brief Hits per thousand records */
+    uint32 BytesIn;          /**< \brief msg text bytes of encoded records */
+    uint32 BytesOut;         /**< \brief Reference and parameter bytes of encoded records */
+    int32  BytesSaved;       /**< \brief BytesIn - BytesOut */
+} ROS_APP_TmplTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_TmplTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_TmplTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App cFE events forwarded to ROS)
+**
+** Each record is a cFE event in /rosout layout: name is the app name, msg
+** the event text, file "cfe_evs" and line the event ID.  sec/nsec are the
+** event's cFE time.  Only the first Count records are sent.
+*/
+#define ROS_APP_EVS_BATCH_RECORDS 8
+
+typedef struct
+{
+    uint16                   Count;   /**< \brief Records in this batch */
+    uint16                   Dropped; /**< \brief Events lost to the rate cap since the last batch */
+    ROS_APP_Rosout_Payload_t Records[ROS_APP_EVS_BATCH_RECORDS];
+} ROS_APP_EvsBatch_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t  TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_EvsBatch_Payload_t Payload;   /**< \brief Batch of converted events */
+} ROS_APP_EvsBatchTlm_t;
+
+typedef struct
+{
+    uint8  Enabled;                               /**< \brief EvsForward from the table */
+    uint8  spare[3];
+    uint32 Received;                              /**< \brief Events received from EVS */
+    uint32 Forwarded[ROS_APP_SEVERITY_COUNT];     /**< \brief Events placed in a batch */
+    uint32 Filtered[ROS_APP_SEVERITY_COUNT];      /**< \brief Events below their app's severity */
+    uint32 RateLimited[ROS_APP_SEVERITY_COUNT];   /**< \brief Events over the rate cap */
+    uint32 Batches;                               /**< \brief Batches sent */
+    uint32 BatchErrors;                           /**< \brief Batches the software bus refused */
+} ROS_APP_EvsFwdTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t   TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_EvsFwdTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_EvsFwdTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App flight recorder)
+**
+** The recorder keeps the latest ERROR and FATAL records, and the command
+** counters, in the Critical Data Store so they survive a processor reset.
+** A dump sends one ROS_APP_RecorderTlm_t followed by one
+** ROS_APP_RecorderRecTlm_t per record, oldest first.
+*/
+typedef struct
+{
+    uint32 RosoutMsgCount; /**< \brief /rosout packets processed */
+    uint8  CmdCounter;     /**< \brief Commands accepted */
+    uint8  ErrCounter;     /**< \brief Commands rejected */
+    uint8  spare[2];
+} ROS_APP_RecorderCounters_t;
+
+typedef struct
+{
+    uint32                   Seq;      /**< \brief Recorder sequence number, 0 for an empty slot */
+    uint32                   Seconds;  /**< \brief cFE time the record was received */
+    uint32                   Subsecs;
+    uint8                    Severity; /**< \brief ROS_APP_SEVERITY_ERROR or ROS_APP_SEVERITY_FATAL */
+    uint8                    spare[3];
+    ROS_APP_Rosout_Payload_t Record;   /**< \brief The record; a long msg is cut to fit */
+} ROS_APP_RecorderEntry_t;
+
+typedef struct
+{
+    uint8                      Enabled;    /**< \brief The CDS blocks were registered */
+    uint8                      Restored;   /**< \brief Contents were recovered at startup */
+    uint16                     Depth;      /**< \brief ROS_APP_RECORDER_DEPTH */
+    uint16                     Records;    /**< \brief Slots holding a record */
+    uint16                     spare;
+    uint32                     NextSeq;    /**< \brief Sequence number the next record will get */
+    uint32                     Restores;   /**< \brief Startups that recovered the recorder */
+    uint32                     ErrorCount; /**< \brief ERROR records recorded */
+    uint32                     FatalCount; /**< \brief FATAL records recorded */
+    uint32                     CdsErrors;  /**< \brief Failed CDS writes */
+    ROS_APP_RecorderCounters_t Counters;   /**< \brief Counters as last saved */
+} ROS_APP_RecorderTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t     TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_RecorderTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_RecorderTlm_t;
+
+typedef struct
+{
+    uint16                  Index; /**< \brief 0 .. Total - 1, oldest first */
+    uint16                  Total; /**< \brief Records in this dump */
+    ROS_APP_RecorderEntry_t Entry;
+} ROS_APP_RecorderRec_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t     TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_RecorderRec_Payload_t Payload;   /**< \brief One recorded entry */
+} ROS_APP_RecorderRecTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App capture file export)
+*/
+#define ROS_APP_EXPORT_STATE_IDLE    0
+#define ROS_APP_EXPORT_STATE_RUNNING 1
+
+typedef struct
+{
+    uint8  State;            /**< \brief ROS_APP_EXPORT_STATE_* */
+    uint8  Format;           /**< \brief ROS_APP_EXPORT_FORMAT_* of the current or last export */
+    uint8  Stopped;          /**< \brief The last export was stopped by command */
+    uint8  spare;
+    uint32 RecordsRead;      /**< \brief Records read from the capture file */
+    uint32 RecordsExported;  /**< \brief Records written to the export file */
+    uint32 RecordsSkipped;   /**< \brief Records outside the time range, or fragments */
+    uint32 ReadErrors;       /**< \brief Capture records that could not be read */
+    uint32 FileBytes;        /**< \brief Size of the capture file */
+    uint32 BytesRead;        /**< \brief Capture file bytes consumed */
+    uint32 BytesWritten;     /**< \brief Export file bytes written */
+    uint32 Blocks;           /**< \brief Blocks handed to the writer */
+    uint32 WriteErrors;      /**< \brief Blocks that could not be written */
+    uint32 WriterWaits;      /**< \brief Times formatting waited for a free block */
+    uint32 Yields;           /**< \brief Times formatting gave up the CPU */
+    uint32 ElapsedMs;        /**< \brief Time since the export started */
+    uint32 RecordsPerSec;    /**< \brief RecordsRead / ElapsedMs */
+    uint32 BytesPerSec;      /**< \brief BytesWritten / ElapsedMs */
+    uint16 ProgressPermille; /**< \brief BytesRead / FileBytes */
+    uint8  spare2[2];
+} ROS_APP_ExportTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t   TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_ExportTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_ExportTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App flow control advice to the ROS bridge)
+**
+** Sent when the state changes and every ROS_APP_FLOW_REFRESH_MS.  The
+** bridge should keep each severity under its MaxMsgPerSec, which may stay
+** limited for a while after the state returns to NORMAL; ERROR and FATAL
+** are never limited.
+*/
+#define ROS_APP_FLOW_STATE_NORMAL    0
+#define ROS_APP_FLOW_STATE_CONGESTED 1
+
+#define ROS_APP_FLOW_UNLIMITED 0xFFFFFFFF
+
+typedef struct
+{
+    uint8  State;            /**< \brief ROS_APP_FLOW_STATE_* */
+    uint8  LevelPct;         /**< \brief Higher of PipePct and QueuePct */
+    uint8  PipePct;          /**< \brief Estimated command pipe occupancy */
+    uint8  QueuePct;         /**< \brief Occupancy of the fullest downlink queue */
+    uint32 Seq;              /**< \brief Incremented on every packet */
+    uint32 ServiceMsgPerSec; /**< \brief /rosout records processed per second since the last packet */
+    uint32 BudgetMsgPerSec;  /**< \brief Total recommended rate, or ROS_APP_FLOW_UNLIMITED */
+    uint32 MaxMsgPerSec[ROS_APP_SEVERITY_COUNT]; /**< \brief Recommended rate per severity */
+    uint32 Transitions;      /**< \brief State changes since reset */
+    uint32 CongestedMs;      /**< \brief Time spent CONGESTED since reset */
+} ROS_APP_FlowCtl_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_FlowCtl_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_FlowCtlTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App rollup summary)
+**
+** The packet ends after the last used entry of Nodes.  FirstError and
+** LastError are only filled in when the interval had ERROR or FATAL
+** records, and are the same record when it had one.
+*/
+typedef struct
+{
+    char   Node[ROS_APP_NODE_NAME_BYTES];
+    uint32 Counts[ROS_APP_SEVERITY_COUNT]; /**< \brief Records by severity */
+} ROS_APP_RollupNode_t;
+
+typedef struct
+{
+    uint32 sec;      /**< \brief ROS time of the record */
+    uint32 nsec;
+    uint8  Severity; /**< \brief ROS_APP_SEVERITY_ERROR or ROS_APP_SEVERITY_FATAL */
+    uint8  spare[3];
+    char   name[ROS_APP_NODE_NAME_BYTES];
+    char   msg[ROS_APP_ROLLUP_TEXT_BYTES];
+} ROS_APP_RollupText_t;
+
+typedef struct
+{
+    uint32               Seq;        /**< \brief Incremented on every summary */
+    uint32               IntervalMs; /**< \brief Time covered by this summary */
+    uint32               Counts[ROS_APP_SEVERITY_COUNT];      /**< \brief All records by severity */
+    uint32               OtherCounts[ROS_APP_SEVERITY_COUNT]; /**< \brief Records from nodes not in Nodes */
+    uint16               NodeCount;  /**< \brief Used entries of Nodes */
+    uint8                spare[2];
+    ROS_APP_RollupText_t FirstError;
+    ROS_APP_RollupText_t LastError;
+    ROS_APP_RollupNode_t Nodes[ROS_APP_ROLLUP_MAX_NODES];
+} ROS_APP_RollupTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t   TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_RollupTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_RollupTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App per-node severity thresholds)
+*/
+typedef struct
+{
+    uint32 Hits;  /**< \brief Records seen from the node */
+    uint32 Drops; /**< \brief Records below the node's threshold */
+} ROS_APP_FilterCounts_t;
+
+typedef struct
+{
+    uint8                  DefaultMinSeverity; /**< \brief Threshold for nodes not in the table */
+    uint8                  NodeCount;          /**< \brief Nodes listed in the table */
+    uint8                  spare[2];
+    ROS_APP_FilterCounts_t Default;                         /**< \brief Nodes not in the table */
+    ROS_APP_FilterCounts_t Nodes[ROS_APP_FILTER_MAX_NODES]; /**< \brief Indexed like the table's NodeFilters */
+} ROS_APP_FilterTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t   TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_FilterTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_FilterTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App sequence gaps and loss)
+**
+** In[] is indexed by ingest stream: ROS_APP_ROSOUT_DEBUG_MID through
+** ROS_APP_ROSOUT_FATAL_MID, then ROS_APP_ROSOUT_FRAG_MID.
+*/
+#define ROS_APP_SEQ_STREAM_FRAG  5
+#define ROS_APP_SEQ_IN_STREAMS   6
+
+typedef struct
+{
+    uint32 Received;   /**< \brief Packets seen on the MID */
+    uint32 Lost;       /**< \brief Packets missing from the sequence */
+    uint32 Gaps;       /**< \brief Breaks in the sequence */
+    uint32 OutOfOrder; /**< \brief Late or repeated packets */
+    uint16 MaxGap;     /**< \brief Most packets missing in one break */
+    uint16 LossBp;     /**< \brief Lost / (Lost + Received), in 0.01% */
+    uint16 LastSeq;    /**< \brief Sequence count of the latest packet */
+    uint16 spare;
+} ROS_APP_SeqInTlm_t;
+
+typedef struct
+{
+    uint32 MsgId;   /**< \brief Product MID, 0 for unused entries */
+    uint32 Sent;    /**< \brief Packets sent */
+    uint16 LastSeq; /**< \brief Sequence count of the latest packet */
+    uint16 spare;
+} ROS_APP_SeqOutTlm_t;
+
+typedef struct
+{
+    ROS_APP_SeqInTlm_t  In[ROS_APP_SEQ_IN_STREAMS];    /**< \brief Incoming /rosout streams */
+    ROS_APP_SeqOutTlm_t Out[ROS_APP_SEQ_MAX_PRODUCTS]; /**< \brief Downlinked log products */
+} ROS_APP_SeqTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_SeqTlm_Payload_t  Payload;   /**< \brief Telemetry payload */
+} ROS_APP_SeqTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App last-value cache dump)
+*/
+typedef struct
+{
+    uint32 sec;   /**< \brief ROS time of the newest record */
+    uint32 nsec;
+    uint32 Count; /**< \brief Records seen, 0 if none yet */
+    char   msg[ROS_APP_LVC_TEXT_BYTES];
+} ROS_APP_LvcEntry_t;
+
+typedef struct
+{
+    char               Node[ROS_APP_NODE_NAME_BYTES];
+    ROS_APP_LvcEntry_t Last[ROS_APP_SEVERITY_COUNT]; /**< \brief Indexed by ROS_APP_SEVERITY_* */
+} ROS_APP_LvcNode_t;
+
+typedef struct
+{
+    uint32            DumpSeq;   /**< \brief Incremented on every dump */
+    uint16            Packet;    /**< \brief Index of this packet in the dump */
+    uint16            Packets;   /**< \brief Packets in the dump */
+    uint16            NodeCount; /**< \brief Nodes in the cache */
+    uint16            NodesHere; /**< \brief Used entries of Nodes; the packet ends there */
+    uint32            Uncached;  /**< \brief Records from nodes that did not fit */
+    ROS_APP_LvcNode_t Nodes[ROS_APP_LVC_NODES_PER_PKT];
+} ROS_APP_LvcTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_LvcTlm_Payload_t  Payload;   /**< \brief Telemetry payload */
+} ROS_APP_LvcTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App node liveness)
+*/
+#define ROS_APP_LIVENESS_ALIVE  0
+#define ROS_APP_LIVENESS_SILENT 1
+
+typedef struct
+{
+    uint32 Seq;          /**< \brief Incremented on every packet */
+    uint16 Tracked;      /**< \brief Nodes being tracked */
+    uint16 Silent;       /**< \brief Tracked nodes that are silent now */
+    uint32 Untracked;    /**< \brief Records from nodes that did not fit */
+    uint32 Transitions;  /**< \brief Nodes gone silent or back since reset */
+    char   Node[ROS_APP_NODE_NAME_BYTES]; /**< \brief Node that changed state */
+    uint8  State;        /**< \brief ROS_APP_LIVENESS_ALIVE or ROS_APP_LIVENESS_SILENT */
+    uint8  spare[3];
+    uint32 SilenceMs;    /**< \brief The node's threshold */
+    uint32 SilentForMs;  /**< \brief Time since the node was last heard from */
+} ROS_APP_LivenessTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t     TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_LivenessTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_LivenessTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (ros App ROS-to-cFE clock correlation)
+**
+** cFE time = ROS time + Offset + DriftPpb * (ROS time - Ref) / 1e9, with
+** Offset = OffsetSec + OffsetUsec / 1e6 and Ref = RefSec + RefNsec / 1e9.
+*/
+typedef struct
+{
+    uint8  Valid;           /**< \brief Records are being stamped with the model */
+    uint8  Samples;         /**< \brief Samples in the window */
+    uint16 spare;
+    uint32 RefSec;          /**< \brief ROS time the offset applies at */
+    uint32 RefNsec;
+    int32  OffsetSec;       /**< \brief cFE minus ROS time, whole seconds rounded down */
+    uint32 OffsetUsec;      /**< \brief Fraction of the offset, 0 to 999999 */
+    int32  DriftPpb;        /**< \brief Change in offset per unit of ROS time */
+    uint32 ResidualUsec;    /**< \brief RMS distance of the samples from the model */
+    uint32 MaxResidualUsec; /**< \brief Largest distance of a sample from the model */
+    uint32 SpanMs;          /**< \brief ROS time covered by the window */
+    uint32 Resets;          /**< \brief Windows restarted after a clock step */
+    uint32 Stamped;         /**< \brief Records stamped with the model */
+} ROS_APP_ClockTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t  TlmHeader; /**< \brief Telemetry header */
+    ROS_APP_ClockTlm_Payload_t Payload;   /**< \brief Telemetry payload */
+} ROS_APP_ClockTlm_t;
+
 #endif /* _ros_app_msg_h_ */
 
 /************************/
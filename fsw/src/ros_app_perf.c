@@ -0,0 +1,136 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_perf.c
+**
+** Purpose:
+**   In-app execution time histograms for the ros App processing stages.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_perf.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Perf_Init                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the histograms and initializes their telemetry packet.      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Perf_Init(ROS_APP_Perf_t *Perf, uint32 MidOffset)
+{
+    memset(Perf, 0, sizeof(*Perf));
+
+    CFE_MSG_Init(&Perf->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_PERF_TLM_MID + MidOffset), sizeof(Perf->Tlm));
+
+} /* End of ROS_APP_Perf_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Perf_Reset                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the histograms.                                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Perf_Reset(ROS_APP_Perf_t *Perf)
+{
+    memset(Perf->TotalNsec, 0, sizeof(Perf->TotalNsec));
+    memset(&Perf->Tlm.Payload, 0, sizeof(Perf->Tlm.Payload));
+
+} /* End of ROS_APP_Perf_Reset() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Perf_Start                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the start time of a stage in nanoseconds.                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint64 ROS_APP_Perf_Start(void)
+{
+    OS_time_t Now;
+
+    CFE_PSP_GetTime(&Now);
+
+    return (uint64)OS_TimeGetTotalNanoseconds(Now);
+
+} /* End of ROS_APP_Perf_Start() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Perf_Stop                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Adds the time since StartNsec to a stage's histogram.              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Perf_Stop(ROS_APP_Perf_t *Perf, uint32 Stage, uint64 StartNsec)
+{
+    ROS_APP_PerfStageTlm_t *Hist = &Perf->Tlm.Payload.Stage[Stage];
+    uint64                  Elapsed;
+    uint32                  Bucket;
+
+    Elapsed = ROS_APP_Perf_Start() - StartNsec;
+
+    if (Elapsed > 0xFFFFFFFF)
+    {
+        Elapsed = 0xFFFFFFFF;
+    }
+
+    /*
+    ** floor(log2(Elapsed)), clamped to the histogram
+    */
+    Bucket = 0;
+    while ((Elapsed >> (Bucket + 1)) != 0 && Bucket < ROS_APP_PERF_HIST_BUCKETS - 1)
+    {
+        Bucket++;
+    }
+
+    Hist->Buckets[Bucket]++;
+    Hist->Count++;
+
+    Perf->TotalNsec[Stage] += Elapsed;
+    Hist->TotalUsec = (uint32)(Perf->TotalNsec[Stage] / 1000);
+
+    if (Elapsed > Hist->MaxNsec)
+    {
+        Hist->MaxNsec = (uint32)Elapsed;
+    }
+
+} /* End of ROS_APP_Perf_Stop() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Perf_SendTlm                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends every stage's histogram in one packet.                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Perf_SendTlm(ROS_APP_Perf_t *Perf)
+{
+    CFE_SB_TimeStampMsg(&Perf->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Perf->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_Perf_SendTlm() */
@@ -0,0 +1,61 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_perf.h
+**
+** Purpose:
+**   In-app execution time histograms for the ros App processing stages.
+**
+** Notes:
+**   Each stage is bracketed by its ES performance marker for the full perf
+**   log and by ROS_APP_Perf_Start/ROS_APP_Perf_Stop, which keep a log2
+**   histogram that can be dumped in flight with ROS_APP_SEND_PERF_CC.
+**
+*******************************************************************************/
+#ifndef _ros_app_perf_h_
+#define _ros_app_perf_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+
+/*
+** Histogram state
+*/
+typedef struct
+{
+    uint64            TotalNsec[ROS_APP_STAGE_COUNT];
+    ROS_APP_PerfTlm_t Tlm;
+
+} ROS_APP_Perf_t;
+
+/*
+** Exported functions
+*/
+void   ROS_APP_Perf_Init(ROS_APP_Perf_t *Perf, uint32 MidOffset);
+void   ROS_APP_Perf_Reset(ROS_APP_Perf_t *Perf);
+uint64 ROS_APP_Perf_Start(void);
+void   ROS_APP_Perf_Stop(ROS_APP_Perf_t *Perf, uint32 Stage, uint64 StartNsec);
+void   ROS_APP_Perf_SendTlm(ROS_APP_Perf_t *Perf);
+
+#endif /* _ros_app_perf_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
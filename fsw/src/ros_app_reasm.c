@@ -0,0 +1,250 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_reasm.c
+**
+** Purpose:
+**   Reassembly of fragmented /rosout messages.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_reasm.h"
+#include "ros_app_utils.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Reasm_Init                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Frees every slot and clears the counters.                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Reasm_Init(ROS_APP_Reasm_t *Reasm, uint32 MidOffset)
+{
+    uint32 i;
+
+    memset(Reasm, 0, sizeof(*Reasm));
+
+    for (i = 0; i < ROS_APP_REASM_MAX_INFLIGHT; i++)
+    {
+        CFE_MSG_Init(&Reasm->Slots[i].Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_ROSOUT_LONG_MID + MidOffset),
+                     sizeof(Reasm->Slots[i].Tlm));
+    }
+
+} /* End of ROS_APP_Reasm_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Reasm_FindSlot                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the slot already collecting this message, or claims a free */
+/*         one, evicting the oldest partial message if all are busy.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static ROS_APP_ReasmSlot_t *ROS_APP_Reasm_FindSlot(ROS_APP_Reasm_t *Reasm, const ROS_APP_RosoutFrag_Payload_t *Frag)
+{
+    ROS_APP_ReasmSlot_t *Slot;
+    ROS_APP_ReasmSlot_t *Free   = NULL;
+    ROS_APP_ReasmSlot_t *Oldest = NULL;
+    uint32               i;
+
+    for (i = 0; i < ROS_APP_REASM_MAX_INFLIGHT; i++)
+    {
+        Slot = &Reasm->Slots[i];
+
+        if (!Slot->InUse)
+        {
+            if (Free == NULL)
+            {
+                Free = Slot;
+            }
+        }
+        else if (Slot->MessageId == Frag->MessageId &&
+                 strncmp(Slot->Tlm.Payload.name, Frag->Record.name, sizeof(Slot->Tlm.Payload.name) - 1) == 0)
+        {
+            return Slot;
+        }
+        else if (Oldest == NULL || Slot->StartUsec < Oldest->StartUsec)
+        {
+            Oldest = Slot;
+        }
+    }
+
+    if (Free == NULL)
+    {
+        Free = Oldest;
+        Reasm->Evicted++;
+    }
+
+    /*
+    ** Take the record fields from whichever fragment arrives first; clear
+    ** the rest so text from the slot's previous message cannot leak through
+    */
+    memset(&Free->Tlm.Payload, 0, sizeof(Free->Tlm.Payload));
+
+    Free->InUse        = true;
+    Free->MessageId    = Frag->MessageId;
+    Free->FragCount    = Frag->FragCount;
+    Free->Received     = 0;
+    Free->ReceivedMask = 0;
+    Free->MsgBytes     = 0;
+    Free->StartUsec    = ROS_APP_GetTimeUsec();
+
+    Free->Tlm.Payload.sec                = Frag->Record.sec;
+    Free->Tlm.Payload.nsec               = Frag->Record.nsec;
+    Free->Tlm.Payload.level              = Frag->Record.level;
+    Free->Tlm.Payload.name_truncated     = Frag->Record.name_truncated;
+    Free->Tlm.Payload.msg_truncated      = false;
+    Free->Tlm.Payload.file_truncated     = Frag->Record.file_truncated;
+    Free->Tlm.Payload.function_truncated = Frag->Record.function_truncated;
+    Free->Tlm.Payload.line               = Frag->Record.line;
+
+    memcpy(Free->Tlm.Payload.name, Frag->Record.name, sizeof(Free->Tlm.Payload.name));
+    memcpy(Free->Tlm.Payload.file, Frag->Record.file, sizeof(Free->Tlm.Payload.file));
+    memcpy(Free->Tlm.Payload.function, Frag->Record.function, sizeof(Free->Tlm.Payload.function));
+
+    Free->Tlm.Payload.name[sizeof(Free->Tlm.Payload.name) - 1]         = 0;
+    Free->Tlm.Payload.file[sizeof(Free->Tlm.Payload.file) - 1]         = 0;
+    Free->Tlm.Payload.function[sizeof(Free->Tlm.Payload.function) - 1] = 0;
+
+    return Free;
+
+} /* End of ROS_APP_Reasm_FindSlot() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Reasm_ProcessFrag                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Stores one fragment.  Returns the reassembled packet when this     */
+/*         fragment completes its message, otherwise NULL.  The packet is     */
+/*         only valid until the next call.                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+ROS_APP_RosoutLongTlm_t *ROS_APP_Reasm_ProcessFrag(ROS_APP_Reasm_t *Reasm, const ROS_APP_RosoutFragTlm_t *Msg)
+{
+    const ROS_APP_RosoutFrag_Payload_t *Frag = &Msg->Payload;
+    ROS_APP_ReasmSlot_t                *Slot;
+    CFE_MSG_Size_t                      MsgSize = 0;
+    uint32                              Offset;
+    uint32                              Bytes;
+    uint32                              Bit;
+
+    CFE_MSG_GetSize(&Msg->TlmHeader.Msg, &MsgSize);
+
+    if (MsgSize != sizeof(*Msg) || Frag->FragCount == 0 || Frag->FragCount > ROS_APP_ROSOUT_MAX_FRAGS ||
+        Frag->FragIndex >= Frag->FragCount || Frag->DataBytes > ROS_APP_ROSOUT_FRAG_DATA_BYTES ||
+        (Frag->FragIndex != Frag->FragCount - 1 && Frag->DataBytes != ROS_APP_ROSOUT_FRAG_DATA_BYTES))
+    {
+        Reasm->Rejected++;
+        return NULL;
+    }
+
+    ROS_APP_Reasm_Expire(Reasm);
+
+    Slot = ROS_APP_Reasm_FindSlot(Reasm, Frag);
+    Bit  = (uint32)1 << Frag->FragIndex;
+
+    if (Slot->FragCount != Frag->FragCount || (Slot->ReceivedMask & Bit) != 0)
+    {
+        Reasm->Rejected++;
+        return NULL;
+    }
+
+    Slot->ReceivedMask |= Bit;
+    Slot->Received++;
+
+    /*
+    ** Copy what fits; text past the long buffer only sets msg_truncated
+    */
+    Offset = (uint32)Frag->FragIndex * ROS_APP_ROSOUT_FRAG_DATA_BYTES;
+    Bytes  = Frag->DataBytes;
+
+    if (Offset + Bytes >= ROS_APP_ROSOUT_LONG_MSG_BYTES)
+    {
+        Slot->Tlm.Payload.msg_truncated = true;
+        Bytes = (Offset < ROS_APP_ROSOUT_LONG_MSG_BYTES - 1) ? (ROS_APP_ROSOUT_LONG_MSG_BYTES - 1 - Offset) : 0;
+    }
+
+    if (Bytes > 0)
+    {
+        memcpy(&Slot->Tlm.Payload.msg[Offset], Frag->Record.msg, Bytes);
+    }
+
+    if (Frag->FragIndex == Frag->FragCount - 1)
+    {
+        Slot->MsgBytes = Slot->Tlm.Payload.msg_truncated ? (ROS_APP_ROSOUT_LONG_MSG_BYTES - 1) : (Offset + Bytes);
+    }
+
+    if (Slot->Received < Slot->FragCount)
+    {
+        return NULL;
+    }
+
+    Slot->Tlm.Payload.msg[Slot->MsgBytes] = 0;
+    Slot->InUse = false;
+    Reasm->Completed++;
+
+    return &Slot->Tlm;
+
+} /* End of ROS_APP_Reasm_ProcessFrag() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Reasm_Expire                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Discards partial messages older than ROS_APP_REASM_TIMEOUT_MS.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Reasm_Expire(ROS_APP_Reasm_t *Reasm)
+{
+    uint64 Now = ROS_APP_GetTimeUsec();
+    uint32 i;
+
+    for (i = 0; i < ROS_APP_REASM_MAX_INFLIGHT; i++)
+    {
+        if (Reasm->Slots[i].InUse && (Now - Reasm->Slots[i].StartUsec) > ((uint64)ROS_APP_REASM_TIMEOUT_MS * 1000))
+        {
+            Reasm->Slots[i].InUse = false;
+            Reasm->TimedOut++;
+        }
+    }
+
+} /* End of ROS_APP_Reasm_Expire() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Reasm_ResetStats                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the reassembly counters, keeping partial messages.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Reasm_ResetStats(ROS_APP_Reasm_t *Reasm)
+{
+    Reasm->Completed = 0;
+    Reasm->TimedOut  = 0;
+    Reasm->Evicted   = 0;
+    Reasm->Rejected  = 0;
+
+} /* End of ROS_APP_Reasm_ResetStats() */
@@ -0,0 +1,82 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_reasm.h
+**
+** Purpose:
+**   Reassembly of fragmented /rosout messages.
+**
+** Notes:
+**   A fixed number of messages can be in flight at once.  A partial message
+**   is discarded when it is older than ROS_APP_REASM_TIMEOUT_MS or when its
+**   slot is needed for a new message and it is the oldest one.
+**
+*******************************************************************************/
+#ifndef _ros_app_reasm_h_
+#define _ros_app_reasm_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+
+/*
+** One message being reassembled
+*/
+typedef struct
+{
+    bool   InUse;
+    uint32 MessageId;
+    uint16 FragCount;
+    uint16 Received;
+    uint32 ReceivedMask;
+    uint32 MsgBytes;
+    uint64 StartUsec;
+
+    ROS_APP_RosoutLongTlm_t Tlm;
+
+} ROS_APP_ReasmSlot_t;
+
+/*
+** Reassembly state
+*/
+typedef struct
+{
+    ROS_APP_ReasmSlot_t Slots[ROS_APP_REASM_MAX_INFLIGHT];
+
+    uint32 Completed;
+    uint32 TimedOut;
+    uint32 Evicted;
+    uint32 Rejected;
+
+} ROS_APP_Reasm_t;
+
+/*
+** Exported functions
+*/
+void                     ROS_APP_Reasm_Init(ROS_APP_Reasm_t *Reasm, uint32 MidOffset);
+ROS_APP_RosoutLongTlm_t *ROS_APP_Reasm_ProcessFrag(ROS_APP_Reasm_t *Reasm, const ROS_APP_RosoutFragTlm_t *Msg);
+void                     ROS_APP_Reasm_Expire(ROS_APP_Reasm_t *Reasm);
+void                     ROS_APP_Reasm_ResetStats(ROS_APP_Reasm_t *Reasm);
+
+#endif /* _ros_app_reasm_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,367 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_recorder.c
+**
+** Purpose:
+**   Critical Data Store flight recorder for ERROR and FATAL records.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_recorder.h"
+#include "ros_app_utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Recorder_WriteHdr                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Copies the header to its CDS block.                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Recorder_WriteHdr(ROS_APP_Recorder_t *Recorder)
+{
+    if (Recorder->Enabled && CFE_ES_CopyToCDS(Recorder->HdrHandle, &Recorder->Hdr) != CFE_SUCCESS)
+    {
+        Recorder->CdsErrors++;
+    }
+
+} /* End of ROS_APP_Recorder_WriteHdr() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Recorder_SlotValid                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns true if a slot holds one of the last Depth records the     */
+/*         header accounts for.                                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool ROS_APP_Recorder_SlotValid(const ROS_APP_Recorder_t *Recorder, uint32 Index)
+{
+    const ROS_APP_RecorderEntry_t *Slot = &Recorder->Slots[Index];
+
+    return Slot->Seq != 0 && Slot->Seq < Recorder->Hdr.NextSeq &&
+           Recorder->Hdr.NextSeq - Slot->Seq <= ROS_APP_RECORDER_DEPTH &&
+           Slot->Seq % ROS_APP_RECORDER_DEPTH == Index &&
+           (Slot->Severity == ROS_APP_SEVERITY_ERROR || Slot->Severity == ROS_APP_SEVERITY_FATAL);
+
+} /* End of ROS_APP_Recorder_SlotValid() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Recorder_Init                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Registers the CDS blocks and, when they survived a reset, reads    */
+/*         them back.  Restored is set if the header was recovered; the       */
+/*         caller takes its counters from Hdr.Counters.  Without a CDS the    */
+/*         recorder still keeps the records in memory for dumps.             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Recorder_Init(ROS_APP_Recorder_t *Recorder, uint8 Instance, uint32 MidOffset)
+{
+    char   BaseName[CFE_MISSION_ES_CDS_MAX_NAME_LENGTH];
+    char   Name[CFE_MISSION_ES_CDS_MAX_NAME_LENGTH];
+    int32  Status;
+    uint32 i;
+
+    memset(Recorder, 0, sizeof(*Recorder));
+
+    CFE_MSG_Init(&Recorder->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_RECORDER_TLM_MID + MidOffset),
+                 sizeof(Recorder->Tlm));
+    CFE_MSG_Init(&Recorder->RecTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_RECORDER_REC_MID + MidOffset),
+                 sizeof(Recorder->RecTlm));
+
+    /*
+    ** Header first, since it decides which records are still good
+    */
+    ROS_APP_InstanceName(Name, sizeof(Name), "RosRecHdr", Instance);
+    Status = CFE_ES_RegisterCDS(&Recorder->HdrHandle, sizeof(Recorder->Hdr), Name);
+    if (Status == CFE_ES_CDS_ALREADY_EXISTS)
+    {
+        Recorder->Restored = CFE_ES_RestoreFromCDS(&Recorder->Hdr, Recorder->HdrHandle) == CFE_SUCCESS &&
+                             Recorder->Hdr.Magic == ROS_APP_RECORDER_MAGIC &&
+                             Recorder->Hdr.Version == ROS_APP_RECORDER_VERSION &&
+                             Recorder->Hdr.Depth == ROS_APP_RECORDER_DEPTH && Recorder->Hdr.NextSeq != 0;
+    }
+    else if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("ros App: Error registering CDS %s, RC = 0x%08lX\n", Name, (unsigned long)Status);
+    }
+
+    if (!Recorder->Restored)
+    {
+        memset(&Recorder->Hdr, 0, sizeof(Recorder->Hdr));
+        Recorder->Hdr.Magic   = ROS_APP_RECORDER_MAGIC;
+        Recorder->Hdr.Version = ROS_APP_RECORDER_VERSION;
+        Recorder->Hdr.Depth   = ROS_APP_RECORDER_DEPTH;
+        Recorder->Hdr.NextSeq = 1;
+    }
+
+    if (Status != CFE_SUCCESS && Status != CFE_ES_CDS_ALREADY_EXISTS)
+    {
+        Recorder->Restored = false;
+        return;
+    }
+
+    for (i = 0; i < ROS_APP_RECORDER_DEPTH; i++)
+    {
+        snprintf(BaseName, sizeof(BaseName), "RosRec%02lu", (unsigned long)i);
+        ROS_APP_InstanceName(Name, sizeof(Name), BaseName, Instance);
+
+        Status = CFE_ES_RegisterCDS(&Recorder->SlotHandles[i], sizeof(Recorder->Slots[i]), Name);
+        if (Status == CFE_ES_CDS_ALREADY_EXISTS && Recorder->Restored)
+        {
+            if (CFE_ES_RestoreFromCDS(&Recorder->Slots[i], Recorder->SlotHandles[i]) != CFE_SUCCESS ||
+                !ROS_APP_Recorder_SlotValid(Recorder, i))
+            {
+                memset(&Recorder->Slots[i], 0, sizeof(Recorder->Slots[i]));
+            }
+        }
+        else if (Status != CFE_SUCCESS && Status != CFE_ES_CDS_ALREADY_EXISTS)
+        {
+            CFE_ES_WriteToSysLog("ros App: Error registering CDS %s, RC = 0x%08lX\n", Name, (unsigned long)Status);
+            memset(Recorder->Slots, 0, sizeof(Recorder->Slots));
+            Recorder->Restored = false;
+            return;
+        }
+    }
+
+    Recorder->Enabled = true;
+
+    if (Recorder->Restored)
+    {
+        Recorder->Hdr.Restores++;
+    }
+
+    ROS_APP_Recorder_WriteHdr(Recorder);
+
+} /* End of ROS_APP_Recorder_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Recorder_Claim                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the slot for the next record, stamped with its sequence    */
+/*         number and the current time.  The caller fills in Record and       */
+/*         passes the slot to ROS_APP_Recorder_Commit.                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static ROS_APP_RecorderEntry_t *ROS_APP_Recorder_Claim(ROS_APP_Recorder_t *Recorder, uint8 Severity)
+{
+    ROS_APP_RecorderEntry_t *Slot = &Recorder->Slots[Recorder->Hdr.NextSeq % ROS_APP_RECORDER_DEPTH];
+    CFE_TIME_SysTime_t       Now  = CFE_TIME_GetTime();
+
+    Slot->Seq      = Recorder->Hdr.NextSeq;
+    Slot->Seconds  = Now.Seconds;
+    Slot->Subsecs  = Now.Subseconds;
+    Slot->Severity = Severity;
+
+    return Slot;
+
+} /* End of ROS_APP_Recorder_Claim() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Recorder_Commit                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Writes a filled slot to the CDS, then the header that counts it.   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Recorder_Commit(ROS_APP_Recorder_t *Recorder, const ROS_APP_RecorderEntry_t *Slot)
+{
+    if (Recorder->Enabled &&
+        CFE_ES_CopyToCDS(Recorder->SlotHandles[Slot->Seq % ROS_APP_RECORDER_DEPTH], Slot) != CFE_SUCCESS)
+    {
+        Recorder->CdsErrors++;
+    }
+
+    Recorder->Hdr.NextSeq++;
+
+    if (Slot->Severity == ROS_APP_SEVERITY_FATAL)
+    {
+        Recorder->Hdr.FatalCount++;
+    }
+    else
+    {
+        Recorder->Hdr.ErrorCount++;
+    }
+
+    ROS_APP_Recorder_WriteHdr(Recorder);
+
+} /* End of ROS_APP_Recorder_Commit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Recorder_Add                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Records an ERROR or FATAL record; other severities are ignored.    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Recorder_Add(ROS_APP_Recorder_t *Recorder, uint8 Severity, const ROS_APP_Rosout_Payload_t *Record)
+{
+    ROS_APP_RecorderEntry_t *Slot;
+
+    if (Severity != ROS_APP_SEVERITY_ERROR && Severity != ROS_APP_SEVERITY_FATAL)
+    {
+        return;
+    }
+
+    Slot = ROS_APP_Recorder_Claim(Recorder, Severity);
+    memcpy(&Slot->Record, Record, sizeof(Slot->Record));
+    ROS_APP_Recorder_Commit(Recorder, Slot);
+
+} /* End of ROS_APP_Recorder_Add() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Recorder_AddLong                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Records a reassembled message, keeping the start of its text.      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Recorder_AddLong(ROS_APP_Recorder_t *Recorder, uint8 Severity,
+                              const ROS_APP_RosoutLong_Payload_t *Record)
+{
+    ROS_APP_RecorderEntry_t *Slot;
+    ROS_APP_Rosout_Payload_t *Dst;
+
+    if (Severity != ROS_APP_SEVERITY_ERROR && Severity != ROS_APP_SEVERITY_FATAL)
+    {
+        return;
+    }
+
+    Slot = ROS_APP_Recorder_Claim(Recorder, Severity);
+    Dst  = &Slot->Record;
+
+    Dst->sec                = Record->sec;
+    Dst->nsec               = Record->nsec;
+    Dst->level              = Record->level;
+    Dst->name_truncated     = Record->name_truncated;
+    Dst->file_truncated     = Record->file_truncated;
+    Dst->function_truncated = Record->function_truncated;
+    Dst->line               = Record->line;
+    memcpy(Dst->name, Record->name, sizeof(Dst->name));
+    memcpy(Dst->file, Record->file, sizeof(Dst->file));
+    memcpy(Dst->function, Record->function, sizeof(Dst->function));
+
+    memcpy(Dst->msg, Record->msg, sizeof(Dst->msg) - 1);
+    Dst->msg[sizeof(Dst->msg) - 1] = 0;
+    Dst->msg_truncated = Record->msg_truncated || memchr(Record->msg, 0, sizeof(Dst->msg)) == NULL;
+
+    ROS_APP_Recorder_Commit(Recorder, Slot);
+
+} /* End of ROS_APP_Recorder_AddLong() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Recorder_SaveCounters                                      */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Saves the command counters, rewriting the header only if they      */
+/*         changed since the last save.                                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Recorder_SaveCounters(ROS_APP_Recorder_t *Recorder, const ROS_APP_RecorderCounters_t *Counters)
+{
+    if (memcmp(&Recorder->Hdr.Counters, Counters, sizeof(*Counters)) != 0)
+    {
+        memcpy(&Recorder->Hdr.Counters, Counters, sizeof(*Counters));
+        ROS_APP_Recorder_WriteHdr(Recorder);
+    }
+
+} /* End of ROS_APP_Recorder_SaveCounters() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Recorder_Count                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the number of slots holding a record.                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint16 ROS_APP_Recorder_Count(const ROS_APP_Recorder_t *Recorder)
+{
+    uint16 Count = 0;
+    uint32 i;
+
+    for (i = 0; i < ROS_APP_RECORDER_DEPTH; i++)
+    {
+        if (ROS_APP_Recorder_SlotValid(Recorder, i))
+        {
+            Count++;
+        }
+    }
+
+    return Count;
+
+} /* End of ROS_APP_Recorder_Count() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Recorder_SendTlm                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Dumps the recorder: the summary packet, then every record, oldest  */
+/*         first.                                                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Recorder_SendTlm(ROS_APP_Recorder_t *Recorder)
+{
+    ROS_APP_RecorderTlm_Payload_t *Summary = &Recorder->Tlm.Payload;
+    uint32                         Seq;
+    uint32                         Index;
+
+    Summary->Enabled    = Recorder->Enabled;
+    Summary->Restored   = Recorder->Restored;
+    Summary->Depth      = ROS_APP_RECORDER_DEPTH;
+    Summary->Records    = ROS_APP_Recorder_Count(Recorder);
+    Summary->NextSeq    = Recorder->Hdr.NextSeq;
+    Summary->Restores   = Recorder->Hdr.Restores;
+    Summary->ErrorCount = Recorder->Hdr.ErrorCount;
+    Summary->FatalCount = Recorder->Hdr.FatalCount;
+    Summary->CdsErrors  = Recorder->CdsErrors;
+    memcpy(&Summary->Counters, &Recorder->Hdr.Counters, sizeof(Summary->Counters));
+
+    CFE_SB_TimeStampMsg(&Recorder->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Recorder->Tlm.TlmHeader.Msg, true);
+
+    Recorder->RecTlm.Payload.Index = 0;
+    Recorder->RecTlm.Payload.Total = Summary->Records;
+
+    Seq = (Recorder->Hdr.NextSeq > ROS_APP_RECORDER_DEPTH) ? Recorder->Hdr.NextSeq - ROS_APP_RECORDER_DEPTH : 1;
+    for (; Seq < Recorder->Hdr.NextSeq; Seq++)
+    {
+        Index = Seq % ROS_APP_RECORDER_DEPTH;
+        if (Recorder->Slots[Index].Seq != Seq || !ROS_APP_Recorder_SlotValid(Recorder, Index))
+        {
+            continue;
+        }
+
+        memcpy(&Recorder->RecTlm.Payload.Entry, &Recorder->Slots[Index], sizeof(Recorder->RecTlm.Payload.Entry));
+        CFE_SB_TimeStampMsg(&Recorder->RecTlm.TlmHeader.Msg);
+        CFE_SB_TransmitMsg(&Recorder->RecTlm.TlmHeader.Msg, true);
+
+        Recorder->RecTlm.Payload.Index++;
+    }
+
+} /* End of ROS_APP_Recorder_SendTlm() */
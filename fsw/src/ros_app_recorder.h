@@ -0,0 +1,98 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_recorder.h
+**
+** Purpose:
+**   Critical Data Store flight recorder for ERROR and FATAL records.
+**
+** Notes:
+**   The recorder is a ring of ROS_APP_RECORDER_DEPTH records plus a small
+**   header holding the ring position and the command counters.  Every
+**   record and the header is a CDS block of its own, so recording writes
+**   one record block and the header rather than the whole ring, and saving
+**   the counters at housekeeping rewrites only the header.  A record
+**   block is written before the header that accounts for it, and carries
+**   its own sequence number, so a reset between the two writes costs at
+**   most that record.  After a processor reset the blocks are read back
+**   in ROS_APP_Init; blocks that fail their CRC or do not belong to the
+**   ring described by the header are dropped.
+**
+*******************************************************************************/
+#ifndef _ros_app_recorder_h_
+#define _ros_app_recorder_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+
+#define ROS_APP_RECORDER_MAGIC   0x52524543 /* "RREC" */
+#define ROS_APP_RECORDER_VERSION 1
+
+/*
+** Contents of the header block
+*/
+typedef struct
+{
+    uint32                     Magic;
+    uint16                     Version;
+    uint16                     Depth;
+    uint32                     NextSeq;  /* Slot is Seq % Depth; sequence numbers start at 1 */
+    uint32                     Restores;
+    uint32                     ErrorCount;
+    uint32                     FatalCount;
+    ROS_APP_RecorderCounters_t Counters;
+
+} ROS_APP_RecorderHdr_t;
+
+/*
+** Recorder state.  Hdr and Slots mirror the CDS blocks.
+*/
+typedef struct
+{
+    bool                    Enabled;
+    bool                    Restored;
+    uint32                  CdsErrors;
+    CFE_ES_CDSHandle_t      HdrHandle;
+    CFE_ES_CDSHandle_t      SlotHandles[ROS_APP_RECORDER_DEPTH];
+    ROS_APP_RecorderHdr_t   Hdr;
+    ROS_APP_RecorderEntry_t Slots[ROS_APP_RECORDER_DEPTH];
+
+    ROS_APP_RecorderTlm_t    Tlm;
+    ROS_APP_RecorderRecTlm_t RecTlm;
+
+} ROS_APP_Recorder_t;
+
+/*
+** Exported functions
+*/
+void   ROS_APP_Recorder_Init(ROS_APP_Recorder_t *Recorder, uint8 Instance, uint32 MidOffset);
+void   ROS_APP_Recorder_Add(ROS_APP_Recorder_t *Recorder, uint8 Severity, const ROS_APP_Rosout_Payload_t *Record);
+void   ROS_APP_Recorder_AddLong(ROS_APP_Recorder_t *Recorder, uint8 Severity,
+                                const ROS_APP_RosoutLong_Payload_t *Record);
+void   ROS_APP_Recorder_SaveCounters(ROS_APP_Recorder_t *Recorder, const ROS_APP_RecorderCounters_t *Counters);
+uint16 ROS_APP_Recorder_Count(const ROS_APP_Recorder_t *Recorder);
+void   ROS_APP_Recorder_SendTlm(ROS_APP_Recorder_t *Recorder);
+
+#endif /* _ros_app_recorder_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,495 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_replay.c
+**
+** Purpose:
+**   Capture of the /rosout stream to a file and bench replay of a capture
+**   onto the software bus.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_events.h"
+#include "ros_app.h"
+#include "ros_app_replay.h"
+#include "ros_app_utils.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Replay_Init                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Resets the capture/replay state and its telemetry packet.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Replay_Init(ROS_APP_Replay_t *Replay, uint32 MidOffset)
+{
+    memset(Replay, 0, sizeof(*Replay));
+
+    Replay->MidOffset = MidOffset;
+
+    Replay->CaptureState = ROS_APP_CAPTURE_STATE_IDLE;
+    Replay->CaptureFd    = OS_OBJECT_ID_UNDEFINED;
+    Replay->ReplayState  = ROS_APP_REPLAY_STATE_IDLE;
+    Replay->ReplayFd     = OS_OBJECT_ID_UNDEFINED;
+
+    CFE_MSG_Init(&Replay->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_REPLAY_TLM_MID + MidOffset),
+                 sizeof(Replay->Tlm));
+
+} /* End of ROS_APP_Replay_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Replay_ProcessRosout                                       */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Called for every /rosout packet ros_app receives.  Appends it to   */
+/*         the capture file and, while a replay runs, accumulates the         */
+/*         receive count and latency statistics.                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Replay_ProcessRosout(ROS_APP_Replay_t *Replay, const CFE_MSG_Message_t *MsgPtr)
+{
+    ROS_APP_CaptureRecHdr_t RecHdr;
+    CFE_MSG_Size_t          MsgSize = 0;
+    CFE_TIME_SysTime_t      MsgTime;
+    uint64                  Now;
+    uint64                  Offset;
+    uint32                  Latency;
+
+    if (Replay->CaptureState == ROS_APP_CAPTURE_STATE_IDLE && Replay->ReplayState == ROS_APP_REPLAY_STATE_IDLE)
+    {
+        return;
+    }
+
+    Now = ROS_APP_GetTimeUsec();
+
+    if (Replay->CaptureState == ROS_APP_CAPTURE_STATE_ACTIVE)
+    {
+        if (Replay->CaptureCount == 0)
+        {
+            Replay->CaptureStartUsec = Now;
+        }
+
+        CFE_MSG_GetSize(MsgPtr, &MsgSize);
+
+        Offset            = Now - Replay->CaptureStartUsec;
+        RecHdr.OffsetSec  = (uint32)(Offset / 1000000);
+        RecHdr.OffsetUsec = (uint32)(Offset % 1000000);
+        RecHdr.MsgBytes   = (uint32)MsgSize;
+
+        if (OS_write(Replay->CaptureFd, &RecHdr, sizeof(RecHdr)) == sizeof(RecHdr) &&
+            OS_write(Replay->CaptureFd, MsgPtr, MsgSize) == (int32)MsgSize)
+        {
+            Replay->CaptureCount++;
+        }
+        else
+        {
+            Replay->CaptureErrors++;
+        }
+    }
+
+    if (Replay->ReplayState != ROS_APP_REPLAY_STATE_IDLE)
+    {
+        CFE_MSG_GetMsgTime(MsgPtr, &MsgTime);
+        Latency = ROS_APP_TimeDeltaUsec(CFE_TIME_GetTime(), MsgTime);
+
+        Replay->LatencySumUsec += Latency;
+        if (Latency > Replay->LatencyMaxUsec)
+        {
+            Replay->LatencyMaxUsec = Latency;
+        }
+
+        Replay->LastRxUsec = Now;
+        Replay->RxCount++;
+    }
+
+} /* End of ROS_APP_Replay_ProcessRosout() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Replay_BuildTlm                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Fills a replay statistics payload from the current state.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Replay_BuildTlm(const ROS_APP_Replay_t *Replay, ROS_APP_ReplayTlm_Payload_t *Payload)
+{
+    uint32 RxCount = Replay->RxCount;
+    uint64 Elapsed = 0;
+
+    if (RxCount > 0 && Replay->LastRxUsec > Replay->FirstTxUsec)
+    {
+        Elapsed = Replay->LastRxUsec - Replay->FirstTxUsec;
+    }
+
+    memset(Payload, 0, sizeof(*Payload));
+
+    Payload->CaptureState   = Replay->CaptureState;
+    Payload->ReplayState    = Replay->ReplayState;
+    Payload->RateMultiplier = Replay->RateMultiplier;
+    Payload->CaptureCount   = Replay->CaptureCount;
+    Payload->CaptureErrors  = Replay->CaptureErrors;
+    Payload->TxCount        = Replay->TxCount;
+    Payload->TxErrors       = Replay->TxErrors;
+    Payload->RxCount        = RxCount;
+    Payload->DropCount      = Replay->DropCount;
+    Payload->ElapsedMs      = (uint32)(Elapsed / 1000);
+    Payload->LatencyMaxUsec = Replay->LatencyMaxUsec;
+
+    if (Elapsed > 0)
+    {
+        Payload->ThroughputMsgPerSec = (uint32)(((uint64)RxCount * 1000000) / Elapsed);
+    }
+
+    if (RxCount > 0)
+    {
+        Payload->LatencyAvgUsec = (uint32)(Replay->LatencySumUsec / RxCount);
+    }
+
+} /* End of ROS_APP_Replay_BuildTlm() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Replay_ReadFileHdr                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Reads and checks the header at the start of a capture file,        */
+/*         leaving the file at its first record.  Files of any other version  */
+/*         are rejected.                                                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+bool ROS_APP_Replay_ReadFileHdr(osal_id_t Fd, ROS_APP_CaptureFileHdr_t *FileHdr)
+{
+    memset(FileHdr, 0, sizeof(*FileHdr));
+
+    return OS_read(Fd, FileHdr, sizeof(*FileHdr)) == sizeof(*FileHdr) && FileHdr->Magic == ROS_APP_CAPTURE_MAGIC &&
+           FileHdr->Version == ROS_APP_CAPTURE_VERSION && FileHdr->HeaderBytes == sizeof(*FileHdr);
+
+} /* End of ROS_APP_Replay_ReadFileHdr() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_ReplayTask                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Child task entry point.  Sends each captured message at its        */
+/*         recorded offset divided by the rate multiplier, waits for ros_app  */
+/*         to drain its pipe, then reports the replay statistics.  Messages   */
+/*         are moved from the capturing instance's MIDs to this instance's.   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_ReplayTask(void)
+{
+    ROS_APP_Data_t         *Data   = ROS_APP_ChildTaskData();
+    ROS_APP_Replay_t       *Replay = &Data->Replay;
+    CFE_MSG_Message_t      *MsgPtr = &Replay->Buf.SBBuf.Msg;
+    CFE_SB_MsgId_t          MsgId  = CFE_SB_INVALID_MSG_ID;
+    ROS_APP_CaptureRecHdr_t RecHdr;
+    ROS_APP_ReplayTlm_t     Tlm;
+    uint64                  Offset;
+    uint64                  Due;
+    uint64                  Now;
+    uint32                  LastRx;
+    uint32                  Waited;
+    int32                   status;
+
+    Replay->FirstTxUsec = ROS_APP_GetTimeUsec();
+
+    while (!Replay->StopRequested)
+    {
+        status = OS_read(Replay->ReplayFd, &RecHdr, sizeof(RecHdr));
+        if (status == 0)
+        {
+            break; /* End of file */
+        }
+
+        if (status != sizeof(RecHdr) || RecHdr.MsgBytes < sizeof(CFE_MSG_Message_t) ||
+            RecHdr.MsgBytes > sizeof(Replay->Buf))
+        {
+            Replay->TxErrors++;
+            break;
+        }
+
+        if (OS_read(Replay->ReplayFd, Replay->Buf.Bytes, RecHdr.MsgBytes) != (int32)RecHdr.MsgBytes)
+        {
+            Replay->TxErrors++;
+            break;
+        }
+
+        if (Replay->FileMidOffset != Replay->MidOffset)
+        {
+            CFE_MSG_GetMsgId(MsgPtr, &MsgId);
+            CFE_MSG_SetMsgId(MsgPtr, CFE_SB_ValueToMsgId(CFE_SB_MsgIdToValue(MsgId) - Replay->FileMidOffset +
+                                                         Replay->MidOffset));
+        }
+
+        /*
+        ** Pace to the recorded arrival time.  A multiplier of zero never waits.
+        */
+        if (Replay->RateMultiplier > 0)
+        {
+            Offset = ((uint64)RecHdr.OffsetSec * 1000000) + RecHdr.OffsetUsec;
+            Due    = Replay->FirstTxUsec + (Offset / Replay->RateMultiplier);
+            Now    = ROS_APP_GetTimeUsec();
+
+            if (Due > Now + 1000)
+            {
+                OS_TaskDelay((uint32)((Due - Now) / 1000));
+            }
+        }
+
+        CFE_SB_TimeStampMsg(MsgPtr);
+        status = CFE_SB_TransmitMsg(MsgPtr, true);
+        if (status == CFE_SUCCESS)
+        {
+            Replay->TxCount++;
+        }
+        else
+        {
+            Replay->TxErrors++;
+        }
+    }
+
+    OS_close(Replay->ReplayFd);
+    Replay->ReplayFd    = OS_OBJECT_ID_UNDEFINED;
+    Replay->ReplayState = ROS_APP_REPLAY_STATE_DRAINING;
+
+    /*
+    ** Anything still queued in the pipe is processed by ros_app after the
+    ** last send.  Wait until the receive count stops moving before deciding
+    ** what was dropped.
+    */
+    Waited = 0;
+    do
+    {
+        LastRx = Replay->RxCount;
+        OS_TaskDelay(ROS_APP_REPLAY_DRAIN_POLL_MS);
+        Waited += ROS_APP_REPLAY_DRAIN_POLL_MS;
+    } while (Replay->RxCount != LastRx && Replay->RxCount < Replay->TxCount && Waited < ROS_APP_REPLAY_DRAIN_LIMIT_MS);
+
+    Replay->DropCount   = (Replay->TxCount > Replay->RxCount) ? (Replay->TxCount - Replay->RxCount) : 0;
+    Replay->ReplayState = ROS_APP_REPLAY_STATE_IDLE;
+
+    CFE_MSG_Init(&Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_REPLAY_TLM_MID + Replay->MidOffset), sizeof(Tlm));
+    ROS_APP_Replay_BuildTlm(Replay, &Tlm.Payload);
+    CFE_SB_TimeStampMsg(&Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Tlm.TlmHeader.Msg, true);
+
+    CFE_EVS_SendEvent(ROS_APP_REPLAY_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "ros: replay done, tx=%lu rx=%lu drop=%lu, %lu msg/s, latency avg=%lu max=%lu usec",
+                      (unsigned long)Tlm.Payload.TxCount, (unsigned long)Tlm.Payload.RxCount,
+                      (unsigned long)Tlm.Payload.DropCount, (unsigned long)Tlm.Payload.ThroughputMsgPerSec,
+                      (unsigned long)Tlm.Payload.LatencyAvgUsec, (unsigned long)Tlm.Payload.LatencyMaxUsec);
+
+    CFE_ES_ExitChildTask();
+
+} /* End of ROS_APP_ReplayTask() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_StartCapture -- Start recording /rosout to a file                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_StartCapture(ROS_APP_Data_t *Data, const ROS_APP_StartCaptureCmd_t *Msg)
+{
+    ROS_APP_Replay_t        *Replay = &Data->Replay;
+    ROS_APP_CaptureFileHdr_t FileHdr;
+    char                     Filename[CFE_MISSION_MAX_PATH_LEN];
+    int32                    status;
+
+    if (Replay->CaptureState != ROS_APP_CAPTURE_STATE_IDLE)
+    {
+        CFE_EVS_SendEvent(ROS_APP_CAPTURE_ERR_EID, CFE_EVS_EventType_ERROR, "ros: capture already active");
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    CFE_SB_MessageStringGet(Filename, Msg->Payload.Filename, NULL, sizeof(Filename), sizeof(Msg->Payload.Filename));
+
+    status = OS_OpenCreate(&Replay->CaptureFd, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                           OS_WRITE_ONLY);
+    if (status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(ROS_APP_CAPTURE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: unable to create capture file %s, RC = %ld", Filename, (long)status);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    FileHdr.Magic       = ROS_APP_CAPTURE_MAGIC;
+    FileHdr.Version     = ROS_APP_CAPTURE_VERSION;
+    FileHdr.HeaderBytes = sizeof(FileHdr);
+    FileHdr.MidOffset   = Data->MidOffset;
+
+    if (OS_write(Replay->CaptureFd, &FileHdr, sizeof(FileHdr)) != sizeof(FileHdr))
+    {
+        OS_close(Replay->CaptureFd);
+        Replay->CaptureFd = OS_OBJECT_ID_UNDEFINED;
+
+        CFE_EVS_SendEvent(ROS_APP_CAPTURE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: unable to write capture file header to %s", Filename);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    Replay->CaptureCount  = 0;
+    Replay->CaptureErrors = 0;
+    Replay->CaptureState  = ROS_APP_CAPTURE_STATE_ACTIVE;
+
+    Data->CmdCounter++;
+
+    CFE_EVS_SendEvent(ROS_APP_CAPTURE_INF_EID, CFE_EVS_EventType_INFORMATION, "ros: capturing /rosout to %s",
+                      Filename);
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_StartCapture() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_StopCapture -- Close the capture file                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_StopCapture(ROS_APP_Data_t *Data, const ROS_APP_StopCaptureCmd_t *Msg)
+{
+    ROS_APP_Replay_t *Replay = &Data->Replay;
+
+    if (Replay->CaptureState != ROS_APP_CAPTURE_STATE_ACTIVE)
+    {
+        CFE_EVS_SendEvent(ROS_APP_CAPTURE_ERR_EID, CFE_EVS_EventType_ERROR, "ros: no capture active");
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    OS_close(Replay->CaptureFd);
+    Replay->CaptureFd    = OS_OBJECT_ID_UNDEFINED;
+    Replay->CaptureState = ROS_APP_CAPTURE_STATE_IDLE;
+
+    Data->CmdCounter++;
+
+    CFE_EVS_SendEvent(ROS_APP_CAPTURE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "ros: capture stopped, %lu messages, %lu errors", (unsigned long)Replay->CaptureCount,
+                      (unsigned long)Replay->CaptureErrors);
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_StopCapture() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_StartReplay -- Replay a capture file onto the software bus         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_StartReplay(ROS_APP_Data_t *Data, const ROS_APP_StartReplayCmd_t *Msg)
+{
+    ROS_APP_Replay_t        *Replay = &Data->Replay;
+    ROS_APP_CaptureFileHdr_t FileHdr;
+    char                     Filename[CFE_MISSION_MAX_PATH_LEN];
+    int32                    status;
+
+    if (Replay->ReplayState != ROS_APP_REPLAY_STATE_IDLE)
+    {
+        CFE_EVS_SendEvent(ROS_APP_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR, "ros: replay already active");
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    CFE_SB_MessageStringGet(Filename, Msg->Payload.Filename, NULL, sizeof(Filename), sizeof(Msg->Payload.Filename));
+
+    status = OS_OpenCreate(&Replay->ReplayFd, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    if (status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(ROS_APP_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: unable to open capture file %s, RC = %ld", Filename, (long)status);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    if (!ROS_APP_Replay_ReadFileHdr(Replay->ReplayFd, &FileHdr))
+    {
+        OS_close(Replay->ReplayFd);
+        Replay->ReplayFd = OS_OBJECT_ID_UNDEFINED;
+
+        CFE_EVS_SendEvent(ROS_APP_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR, "ros: %s is not a capture file",
+                          Filename);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    Replay->RateMultiplier = Msg->Payload.RateMultiplier;
+    Replay->FileMidOffset  = FileHdr.MidOffset;
+    Replay->StopRequested  = false;
+    Replay->TxCount        = 0;
+    Replay->TxErrors       = 0;
+    Replay->RxCount        = 0;
+    Replay->DropCount      = 0;
+    Replay->FirstTxUsec    = ROS_APP_GetTimeUsec();
+    Replay->LastRxUsec     = 0;
+    Replay->LatencySumUsec = 0;
+    Replay->LatencyMaxUsec = 0;
+    Replay->ReplayState    = ROS_APP_REPLAY_STATE_RUNNING;
+
+    status = ROS_APP_CreateChildTask(Data, &Replay->TaskId, ROS_APP_REPLAY_TASK_NAME, ROS_APP_ReplayTask,
+                                     ROS_APP_REPLAY_STACK_SIZE, ROS_APP_REPLAY_PRIORITY);
+    if (status != CFE_SUCCESS)
+    {
+        OS_close(Replay->ReplayFd);
+        Replay->ReplayFd    = OS_OBJECT_ID_UNDEFINED;
+        Replay->ReplayState = ROS_APP_REPLAY_STATE_IDLE;
+
+        CFE_EVS_SendEvent(ROS_APP_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ros: unable to create replay task, RC = 0x%08lX", (unsigned long)status);
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    Data->CmdCounter++;
+
+    CFE_EVS_SendEvent(ROS_APP_REPLAY_INF_EID, CFE_EVS_EventType_INFORMATION, "ros: replaying %s at %ux", Filename,
+                      (unsigned int)Replay->RateMultiplier);
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_StartReplay() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* ROS_APP_StopReplay -- Ask the replay task to stop early                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 ROS_APP_StopReplay(ROS_APP_Data_t *Data, const ROS_APP_StopReplayCmd_t *Msg)
+{
+    if (Data->Replay.ReplayState != ROS_APP_REPLAY_STATE_RUNNING)
+    {
+        CFE_EVS_SendEvent(ROS_APP_REPLAY_ERR_EID, CFE_EVS_EventType_ERROR, "ros: no replay running");
+        Data->ErrCounter++;
+        return CFE_SUCCESS;
+    }
+
+    Data->Replay.StopRequested = true;
+    Data->CmdCounter++;
+
+    CFE_EVS_SendEvent(ROS_APP_REPLAY_INF_EID, CFE_EVS_EventType_INFORMATION, "ros: replay stop requested");
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_StopReplay() */
@@ -0,0 +1,132 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_replay.h
+**
+** Purpose:
+**   Capture of the /rosout stream to a file and bench replay of a capture
+**   onto the software bus.
+**
+** Notes:
+**   A capture file is a ROS_APP_CaptureFileHdr_t followed by one
+**   ROS_APP_CaptureRecHdr_t plus the raw SB message per received /rosout
+**   packet.  Offsets are the arrival time relative to the first captured
+**   message.  Files are written in the byte order of the capturing target
+**   and are meant to be replayed on the same kind of target.  The header
+**   records the MID offset of the capturing instance so a capture can be
+**   replayed into any instance.  Only ROS_APP_CAPTURE_VERSION files are
+**   replayed.
+**
+**   While a replay is running ros_app counts every /rosout packet it
+**   processes and the latency from the replay task's SB time stamp to the
+**   moment ros_app handles it, so that the replay task can stand in for the
+**   ROS bridge and measure the app end to end.
+**
+*******************************************************************************/
+#ifndef _ros_app_replay_h_
+#define _ros_app_replay_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+
+#define ROS_APP_CAPTURE_MAGIC   0x52434150 /* "RCAP" */
+#define ROS_APP_CAPTURE_VERSION 2
+
+/*
+** Capture file layout
+*/
+typedef struct
+{
+    uint32 Magic;       /**< \brief ROS_APP_CAPTURE_MAGIC */
+    uint16 Version;     /**< \brief ROS_APP_CAPTURE_VERSION */
+    uint16 HeaderBytes; /**< \brief sizeof(ROS_APP_CaptureFileHdr_t) */
+    uint32 MidOffset;   /**< \brief MID offset of the capturing instance */
+} ROS_APP_CaptureFileHdr_t;
+
+typedef struct
+{
+    uint32 OffsetSec;  /**< \brief Arrival time since the first record, seconds */
+    uint32 OffsetUsec; /**< \brief Arrival time since the first record, microseconds */
+    uint32 MsgBytes;   /**< \brief Size of the SB message that follows */
+} ROS_APP_CaptureRecHdr_t;
+
+/*
+** Capture/replay state
+*/
+typedef struct
+{
+    /*
+    ** Capture, owned by the main task
+    */
+    uint8     CaptureState;
+    osal_id_t CaptureFd;
+    uint64    CaptureStartUsec;
+    uint32    CaptureCount;
+    uint32    CaptureErrors;
+
+    /*
+    ** Replay, shared between the main task and the replay child task
+    */
+    volatile uint8  ReplayState;
+    volatile bool   StopRequested;
+    CFE_ES_TaskId_t TaskId;
+    osal_id_t       ReplayFd;
+    uint16          RateMultiplier;
+    uint32          FileMidOffset;
+
+    uint32 TxCount;
+    uint32 TxErrors;
+    uint32 RxCount;
+    uint32 DropCount;
+    uint64 FirstTxUsec;
+    uint64 LastRxUsec;
+    uint64 LatencySumUsec;
+    uint32 LatencyMaxUsec;
+
+    ROS_APP_ReplayTlm_t Tlm;
+
+    /*
+    ** Replay buffer, only touched by the replay child task
+    */
+    union
+    {
+        CFE_SB_Buffer_t SBBuf;
+        uint8           Bytes[ROS_APP_REPLAY_MAX_MSG_BYTES];
+    } Buf;
+
+    uint32 MidOffset; /* Of the owning instance */
+
+} ROS_APP_Replay_t;
+
+/*
+** Exported functions
+*/
+void  ROS_APP_Replay_Init(ROS_APP_Replay_t *Replay, uint32 MidOffset);
+void  ROS_APP_Replay_ProcessRosout(ROS_APP_Replay_t *Replay, const CFE_MSG_Message_t *MsgPtr);
+void  ROS_APP_Replay_BuildTlm(const ROS_APP_Replay_t *Replay, ROS_APP_ReplayTlm_Payload_t *Payload);
+bool  ROS_APP_Replay_ReadFileHdr(osal_id_t Fd, ROS_APP_CaptureFileHdr_t *FileHdr);
+void  ROS_APP_ReplayTask(void);
+
+#endif /* _ros_app_replay_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
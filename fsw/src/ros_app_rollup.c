@@ -0,0 +1,252 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_rollup.c
+**
+** Purpose:
+**   Rollup summaries of the /rosout stream for low-bandwidth passes.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_rollup.h"
+#include "ros_app_utils.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if ROS_APP_ROLLUP_HASH_SLOTS < 2 * ROS_APP_ROLLUP_MAX_NODES || ROS_APP_ROLLUP_MAX_NODES >= ROS_APP_ROLLUP_NO_NODE
+#error ROS_APP_ROLLUP_HASH_SLOTS must be at least twice ROS_APP_ROLLUP_MAX_NODES
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Rollup_CopyText                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Keeps an ERROR or FATAL record as a summary's first or last error. */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void ROS_APP_Rollup_CopyText(ROS_APP_RollupText_t *Dst, uint8 Severity, const char *Name, uint32 Sec,
+                                    uint32 Nsec, const char *Text, size_t TextBytes)
+{
+    size_t Len = 0;
+
+    Dst->sec      = Sec;
+    Dst->nsec     = Nsec;
+    Dst->Severity = Severity;
+
+    strncpy(Dst->name, Name, sizeof(Dst->name) - 1);
+    Dst->name[sizeof(Dst->name) - 1] = 0;
+
+    while (Len < TextBytes && Len < sizeof(Dst->msg) - 1 && Text[Len] != 0)
+    {
+        Len++;
+    }
+    memcpy(Dst->msg, Text, Len);
+    memset(&Dst->msg[Len], 0, sizeof(Dst->msg) - Len);
+
+} /* End of ROS_APP_Rollup_CopyText() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Rollup_FindNode                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the summary entry for a node, adding it if there is room,  */
+/*         or NULL once the node table is full.                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static ROS_APP_RollupNode_t *ROS_APP_Rollup_FindNode(ROS_APP_Rollup_t *Rollup, const char *Name)
+{
+    ROS_APP_RollupTlm_Payload_t *Payload = &Rollup->Tlm.Payload;
+    ROS_APP_RollupNode_t        *Node;
+    uint32                       Hash;
+    uint32                       Slot;
+    uint32                       Probe;
+    uint8                        Index;
+
+    Hash = ROS_APP_HashName(Name, ROS_APP_NODE_NAME_BYTES - 1);
+    Slot = Hash & (ROS_APP_ROLLUP_HASH_SLOTS - 1);
+
+    for (Probe = 0; Probe < ROS_APP_ROLLUP_HASH_SLOTS; Probe++)
+    {
+        Index = Rollup->Slots[Slot];
+
+        if (Index == ROS_APP_ROLLUP_NO_NODE)
+        {
+            if (Payload->NodeCount >= ROS_APP_ROLLUP_MAX_NODES)
+            {
+                return NULL;
+            }
+
+            Index = (uint8)Payload->NodeCount++;
+            Node  = &Payload->Nodes[Index];
+
+            Rollup->Slots[Slot]   = Index;
+            Rollup->Hashes[Index] = Hash;
+            strncpy(Node->Node, Name, sizeof(Node->Node) - 1);
+
+            return Node;
+        }
+
+        Node = &Payload->Nodes[Index];
+        if (Rollup->Hashes[Index] == Hash && strncmp(Node->Node, Name, sizeof(Node->Node) - 1) == 0)
+        {
+            return Node;
+        }
+
+        Slot = (Slot + 1) & (ROS_APP_ROLLUP_HASH_SLOTS - 1);
+    }
+
+    return NULL;
+
+} /* End of ROS_APP_Rollup_FindNode() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Rollup_Init                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Rollup mode stays off until commanded.                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Rollup_Init(ROS_APP_Rollup_t *Rollup, uint32 MidOffset)
+{
+    memset(Rollup, 0, sizeof(*Rollup));
+
+    Rollup->IntervalMs = ROS_APP_ROLLUP_DEFAULT_INTERVAL_SEC * 1000;
+
+    CFE_MSG_Init(&Rollup->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_ROLLUP_TLM_MID + MidOffset),
+                 sizeof(Rollup->Tlm));
+
+    ROS_APP_Rollup_Start(Rollup);
+
+} /* End of ROS_APP_Rollup_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Rollup_Configure                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes the interval from the table; it applies from the current     */
+/*         interval on.                                                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Rollup_Configure(ROS_APP_Rollup_t *Rollup, uint16 IntervalSec)
+{
+    Rollup->IntervalMs = (uint32)IntervalSec * 1000;
+
+} /* End of ROS_APP_Rollup_Configure() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Rollup_Start                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the summary and starts a new interval.                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Rollup_Start(ROS_APP_Rollup_t *Rollup)
+{
+    ROS_APP_RollupTlm_Payload_t *Payload = &Rollup->Tlm.Payload;
+    uint32                       Seq     = Payload->Seq;
+
+    memset(Payload, 0, offsetof(ROS_APP_RollupTlm_Payload_t, Nodes) +
+                           Payload->NodeCount * sizeof(ROS_APP_RollupNode_t));
+    Payload->Seq = Seq;
+
+    memset(Rollup->Slots, ROS_APP_ROLLUP_NO_NODE, sizeof(Rollup->Slots));
+
+    Rollup->StartUsec = ROS_APP_GetTimeUsec();
+
+} /* End of ROS_APP_Rollup_Start() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Rollup_Add                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Counts one record into the current summary.                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Rollup_Add(ROS_APP_Rollup_t *Rollup, uint8 Severity, const char *Name, uint32 Sec, uint32 Nsec,
+                        const char *Text, size_t TextBytes)
+{
+    ROS_APP_RollupTlm_Payload_t *Payload = &Rollup->Tlm.Payload;
+    ROS_APP_RollupNode_t        *Node;
+
+    Payload->Counts[Severity]++;
+
+    Node = ROS_APP_Rollup_FindNode(Rollup, Name);
+    if (Node != NULL)
+    {
+        Node->Counts[Severity]++;
+    }
+    else
+    {
+        Payload->OtherCounts[Severity]++;
+    }
+
+    if (Severity >= ROS_APP_SEVERITY_ERROR)
+    {
+        if (Payload->Counts[ROS_APP_SEVERITY_ERROR] + Payload->Counts[ROS_APP_SEVERITY_FATAL] == 1)
+        {
+            ROS_APP_Rollup_CopyText(&Payload->FirstError, Severity, Name, Sec, Nsec, Text, TextBytes);
+        }
+
+        ROS_APP_Rollup_CopyText(&Payload->LastError, Severity, Name, Sec, Nsec, Text, TextBytes);
+    }
+
+} /* End of ROS_APP_Rollup_Add() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Rollup_Due                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         True when rollup mode is on and the interval has ended.            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_Rollup_Due(const ROS_APP_Rollup_t *Rollup)
+{
+    return Rollup->Enabled && (ROS_APP_GetTimeUsec() - Rollup->StartUsec) >= (uint64)Rollup->IntervalMs * 1000;
+
+} /* End of ROS_APP_Rollup_Due() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Rollup_Finish                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Completes the summary for the interval so far and returns it,      */
+/*         cut after the last used node.  The caller queues it and then       */
+/*         starts the next interval.                                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+CFE_MSG_Message_t *ROS_APP_Rollup_Finish(ROS_APP_Rollup_t *Rollup)
+{
+    ROS_APP_RollupTlm_Payload_t *Payload = &Rollup->Tlm.Payload;
+
+    Payload->Seq++;
+    Payload->IntervalMs = (uint32)((ROS_APP_GetTimeUsec() - Rollup->StartUsec) / 1000);
+
+    CFE_MSG_SetSize(&Rollup->Tlm.TlmHeader.Msg, offsetof(ROS_APP_RollupTlm_t, Payload.Nodes) +
+                                                    Payload->NodeCount * sizeof(ROS_APP_RollupNode_t));
+    CFE_SB_TimeStampMsg(&Rollup->Tlm.TlmHeader.Msg);
+
+    return &Rollup->Tlm.TlmHeader.Msg;
+
+} /* End of ROS_APP_Rollup_Finish() */
@@ -0,0 +1,75 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_rollup.h
+**
+** Purpose:
+**   Rollup summaries of the /rosout stream for low-bandwidth passes.
+**
+** Notes:
+**   In rollup mode records are not forwarded.  Each is counted by
+**   severity and by node into the summary packet itself, and ERROR and
+**   FATAL records also leave their text as the interval's first or last
+**   error.  Nodes are found through a small open-addressing hash of name
+**   hashes, so a record costs one pass over its name and a short probe.
+**   Once the table of nodes is full, further nodes are counted together.
+**
+*******************************************************************************/
+#ifndef _ros_app_rollup_h_
+#define _ros_app_rollup_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+
+#define ROS_APP_ROLLUP_NO_NODE 0xFF
+
+/*
+** Rollup state.  The summary is built in Tlm as records arrive.
+*/
+typedef struct
+{
+    bool   Enabled;
+    uint32 IntervalMs;
+    uint64 StartUsec;
+
+    uint8  Slots[ROS_APP_ROLLUP_HASH_SLOTS]; /* Index into Tlm.Payload.Nodes, or ROS_APP_ROLLUP_NO_NODE */
+    uint32 Hashes[ROS_APP_ROLLUP_MAX_NODES];
+
+    ROS_APP_RollupTlm_t Tlm;
+
+} ROS_APP_Rollup_t;
+
+/*
+** Exported functions
+*/
+void               ROS_APP_Rollup_Init(ROS_APP_Rollup_t *Rollup, uint32 MidOffset);
+void               ROS_APP_Rollup_Configure(ROS_APP_Rollup_t *Rollup, uint16 IntervalSec);
+void               ROS_APP_Rollup_Start(ROS_APP_Rollup_t *Rollup);
+void               ROS_APP_Rollup_Add(ROS_APP_Rollup_t *Rollup, uint8 Severity, const char *Name, uint32 Sec,
+                                      uint32 Nsec, const char *Text, size_t TextBytes);
+bool               ROS_APP_Rollup_Due(const ROS_APP_Rollup_t *Rollup);
+CFE_MSG_Message_t *ROS_APP_Rollup_Finish(ROS_APP_Rollup_t *Rollup);
+
+#endif /* _ros_app_rollup_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,137 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_sample.c
+**
+** Purpose:
+**   Deterministic 1-in-N sampling of low severity /rosout records.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_sample.h"
+#include "ros_app_utils.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sample_Init                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Keeps every record until the table is loaded.                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Sample_Init(ROS_APP_Sample_t *Sample)
+{
+    memset(Sample, 0, sizeof(*Sample));
+
+} /* End of ROS_APP_Sample_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sample_Configure                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Takes the default rates and the per-node overrides from the table. */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Sample_Configure(ROS_APP_Sample_t *Sample, const uint16 *Rates, const ROS_APP_SampleNode_t *Nodes)
+{
+    ROS_APP_SampleRule_t *Rule;
+    uint32                i;
+
+    memcpy(Sample->Rates, Rates, sizeof(Sample->Rates));
+
+    Sample->RuleCount = 0;
+    for (i = 0; i < ROS_APP_SAMPLE_MAX_NODES; i++)
+    {
+        if (Nodes[i].Node[0] == 0)
+        {
+            continue;
+        }
+
+        Rule = &Sample->Rules[Sample->RuleCount++];
+        memcpy(Rule->Node, Nodes[i].Node, sizeof(Rule->Node));
+        memcpy(Rule->Rates, Nodes[i].Rates, sizeof(Rule->Rates));
+        Rule->NameHash = ROS_APP_HashName(Rule->Node, sizeof(Rule->Node));
+    }
+
+} /* End of ROS_APP_Sample_Configure() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sample_Weight                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns how many records this one stands for if it is kept, or 0   */
+/*         if sampling drops it.  Name is the record's node name and Sec its  */
+/*         ROS second, from a short or a reassembled long record.             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint16 ROS_APP_Sample_Weight(ROS_APP_Sample_t *Sample, uint8 Severity, const char *Name, uint32 Sec)
+{
+    const uint16 *Rates = Sample->Rates;
+    uint32        NameHash;
+    uint32        Hash;
+    uint32        i;
+
+    if (Severity >= ROS_APP_SEVERITY_ERROR)
+    {
+        return 1;
+    }
+
+    NameHash = ROS_APP_HashName(Name, ROS_APP_ROSOUT_TLM_NAME_BYTES);
+
+    for (i = 0; i < Sample->RuleCount; i++)
+    {
+        if (Sample->Rules[i].NameHash == NameHash &&
+            strncmp(Sample->Rules[i].Node, Name, ROS_APP_ROSOUT_TLM_NAME_BYTES) == 0)
+        {
+            Rates = Sample->Rules[i].Rates;
+            break;
+        }
+    }
+
+    if (Rates[Severity] <= 1)
+    {
+        return 1;
+    }
+
+    /*
+    ** Fold in the second and severity, then finish with the murmur3 mixer
+    ** so the low bits used by the modulo are well spread
+    */
+    Hash = (NameHash ^ Sec) * 16777619u;
+    Hash = (Hash ^ Severity) * 16777619u;
+    Hash ^= Hash >> 16;
+    Hash *= 0x85EBCA6Bu;
+    Hash ^= Hash >> 13;
+    Hash *= 0xC2B2AE35u;
+    Hash ^= Hash >> 16;
+
+    if (Hash % Rates[Severity] != 0)
+    {
+        Sample->SampledOut[Severity]++;
+        return 0;
+    }
+
+    return Rates[Severity];
+
+} /* End of ROS_APP_Sample_Weight() */
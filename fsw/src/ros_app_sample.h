@@ -0,0 +1,76 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_sample.h
+**
+** Purpose:
+**   Deterministic 1-in-N sampling of low severity /rosout records.
+**
+** Notes:
+**   The keep decision is a hash of the node name, the record's ROS second
+**   and its severity, so all lines a node logs at one severity within the
+**   same second are kept or dropped together, and the ground can repeat
+**   the decision.  The name hash also locates any per-node rates, so a
+**   record costs one pass over its name.  ERROR and FATAL are never sampled.
+**
+*******************************************************************************/
+#ifndef _ros_app_sample_h_
+#define _ros_app_sample_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_table.h"
+
+/*
+** One per-node override, with its name hash cached
+*/
+typedef struct
+{
+    uint32 NameHash;
+    char   Node[ROS_APP_NODE_NAME_BYTES];
+    uint16 Rates[ROS_APP_SEVERITY_COUNT];
+
+} ROS_APP_SampleRule_t;
+
+/*
+** Sampler state
+*/
+typedef struct
+{
+    uint16               Rates[ROS_APP_SEVERITY_COUNT];
+    uint32               RuleCount;
+    ROS_APP_SampleRule_t Rules[ROS_APP_SAMPLE_MAX_NODES];
+
+    uint32 SampledOut[ROS_APP_SEVERITY_COUNT];
+
+} ROS_APP_Sample_t;
+
+/*
+** Exported functions
+*/
+void   ROS_APP_Sample_Init(ROS_APP_Sample_t *Sample);
+void   ROS_APP_Sample_Configure(ROS_APP_Sample_t *Sample, const uint16 *Rates, const ROS_APP_SampleNode_t *Nodes);
+uint16 ROS_APP_Sample_Weight(ROS_APP_Sample_t *Sample, uint8 Severity, const char *Name, uint32 Sec);
+
+#endif /* _ros_app_sample_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,281 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_sanitize.c
+**
+** Purpose:
+**   Validation and sanitization of /rosout text fields.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_sanitize.h"
+
+#include <string.h>
+
+#if !defined(ROS_APP_SANITIZE_SCALAR) && defined(__SSE2__)
+#include <emmintrin.h>
+#define ROS_APP_SANITIZE_SSE2
+#elif !defined(ROS_APP_SANITIZE_SCALAR) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define ROS_APP_SANITIZE_NEON
+#endif
+
+#define ROS_APP_SANITIZE_BLOCK 16
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_SanitizeScalar                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sanitizes Size bytes starting at Src[Pos], one byte at a time.     */
+/*         Returns the position of the terminating NUL, or Size if there is   */
+/*         none; *Repaired is set if a control character was replaced.        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static size_t ROS_APP_SanitizeScalar(char *Dst, const char *Src, size_t Pos, size_t Size, bool *Repaired)
+{
+    uint8 Byte;
+
+    for (; Pos < Size; Pos++)
+    {
+        Byte = (uint8)Src[Pos];
+
+        if (Byte == 0)
+        {
+            break;
+        }
+
+        if (Byte < 0x20 || Byte == 0x7F)
+        {
+            Byte      = ROS_APP_SANITIZE_REPLACEMENT;
+            *Repaired = true;
+        }
+
+        Dst[Pos] = (char)Byte;
+    }
+
+    return Pos;
+
+} /* End of ROS_APP_SanitizeScalar() */
+
+#if defined(ROS_APP_SANITIZE_SSE2)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_SanitizeBlocks                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         SSE2 version of ROS_APP_SanitizeScalar for whole 16 byte blocks.   */
+/*         Returns at the block holding the NUL, or at the first position     */
+/*         past the last whole block, for the scalar loop to finish.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static size_t ROS_APP_SanitizeBlocks(char *Dst, const char *Src, size_t Size, bool *Repaired)
+{
+    const __m128i Zero    = _mm_setzero_si128();
+    const __m128i MaxCtrl = _mm_set1_epi8(0x1F);
+    const __m128i Del     = _mm_set1_epi8(0x7F);
+    const __m128i Repl    = _mm_set1_epi8(ROS_APP_SANITIZE_REPLACEMENT);
+    __m128i       Block;
+    __m128i       Bad;
+    size_t        Pos;
+
+    for (Pos = 0; Pos + ROS_APP_SANITIZE_BLOCK <= Size; Pos += ROS_APP_SANITIZE_BLOCK)
+    {
+        Block = _mm_loadu_si128((const __m128i *)(const void *)&Src[Pos]);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(Block, Zero)) != 0)
+        {
+            break;
+        }
+
+        /* Unsigned Byte <= 0x1F, or 0x7F */
+        Bad = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(Block, MaxCtrl), Block), _mm_cmpeq_epi8(Block, Del));
+
+        if (_mm_movemask_epi8(Bad) != 0)
+        {
+            Block     = _mm_or_si128(_mm_andnot_si128(Bad, Block), _mm_and_si128(Bad, Repl));
+            *Repaired = true;
+        }
+
+        _mm_storeu_si128((__m128i *)(void *)&Dst[Pos], Block);
+    }
+
+    return Pos;
+
+} /* End of ROS_APP_SanitizeBlocks() */
+
+#elif defined(ROS_APP_SANITIZE_NEON)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_SanitizeBlocks                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         NEON version of ROS_APP_SanitizeScalar for whole 16 byte blocks.   */
+/*         Returns at the block holding the NUL, or at the first position     */
+/*         past the last whole block, for the scalar loop to finish.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static size_t ROS_APP_SanitizeBlocks(char *Dst, const char *Src, size_t Size, bool *Repaired)
+{
+    const uint8x16_t Space = vdupq_n_u8(0x20);
+    const uint8x16_t Del   = vdupq_n_u8(0x7F);
+    const uint8x16_t Repl  = vdupq_n_u8(ROS_APP_SANITIZE_REPLACEMENT);
+    uint8x16_t       Block;
+    uint8x16_t       Bad;
+    size_t           Pos;
+
+    for (Pos = 0; Pos + ROS_APP_SANITIZE_BLOCK <= Size; Pos += ROS_APP_SANITIZE_BLOCK)
+    {
+        Block = vld1q_u8((const uint8 *)&Src[Pos]);
+
+        /* Narrow each 0x00/0xFF lane to a nibble to test 16 lanes at once */
+        if (vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vceqq_u8(Block, vdupq_n_u8(0))), 4)),
+                          0) != 0)
+        {
+            break;
+        }
+
+        Bad = vorrq_u8(vcltq_u8(Block, Space), vceqq_u8(Block, Del));
+
+        if (vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(Bad), 4)), 0) != 0)
+        {
+            Block     = vbslq_u8(Bad, Repl, Block);
+            *Repaired = true;
+        }
+
+        vst1q_u8((uint8 *)&Dst[Pos], Block);
+    }
+
+    return Pos;
+
+} /* End of ROS_APP_SanitizeBlocks() */
+
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_SanitizeField                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Copies a Size byte text field from Src to Dst, which may be the    */
+/*         same buffer, leaving it terminated, free of control characters     */
+/*         and cleared past its end.  *Truncated is set if Src had no NUL.    */
+/*         Returns true if anything had to be repaired.                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_SanitizeField(char *Dst, const char *Src, size_t Size, bool *Truncated)
+{
+    bool   Repaired = false;
+    size_t Len      = 0;
+
+#if defined(ROS_APP_SANITIZE_SSE2) || defined(ROS_APP_SANITIZE_NEON)
+    Len = ROS_APP_SanitizeBlocks(Dst, Src, Size, &Repaired);
+#endif
+
+    Len = ROS_APP_SanitizeScalar(Dst, Src, Len, Size, &Repaired);
+
+    if (Len == Size)
+    {
+        Len        = Size - 1;
+        *Truncated = true;
+        Repaired   = true;
+    }
+
+    memset(&Dst[Len], 0, Size - Len);
+
+    return Repaired;
+
+} /* End of ROS_APP_SanitizeField() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_SanitizeFlag                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Reads a bool field as a byte, since the bridge may have sent       */
+/*         something other than 0 or 1.                                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool ROS_APP_SanitizeFlag(const bool *Flag)
+{
+    uint8 Byte;
+
+    memcpy(&Byte, Flag, sizeof(Byte));
+
+    return Byte != 0;
+
+} /* End of ROS_APP_SanitizeFlag() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_SanitizeRosout                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Copies a record from the bridge with every text field sanitized.   */
+/*         Returns true if any field had to be repaired.                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_SanitizeRosout(ROS_APP_Rosout_Payload_t *Dst, const ROS_APP_Rosout_Payload_t *Src)
+{
+    bool Repaired;
+
+    Dst->sec                = Src->sec;
+    Dst->nsec               = Src->nsec;
+    Dst->level              = Src->level;
+    Dst->line               = Src->line;
+    Dst->name_truncated     = ROS_APP_SanitizeFlag(&Src->name_truncated);
+    Dst->msg_truncated      = ROS_APP_SanitizeFlag(&Src->msg_truncated);
+    Dst->file_truncated     = ROS_APP_SanitizeFlag(&Src->file_truncated);
+    Dst->function_truncated = ROS_APP_SanitizeFlag(&Src->function_truncated);
+
+    Repaired = ROS_APP_SanitizeField(Dst->name, Src->name, sizeof(Dst->name), &Dst->name_truncated);
+    Repaired |= ROS_APP_SanitizeField(Dst->msg, Src->msg, sizeof(Dst->msg), &Dst->msg_truncated);
+    Repaired |= ROS_APP_SanitizeField(Dst->file, Src->file, sizeof(Dst->file), &Dst->file_truncated);
+    Repaired |= ROS_APP_SanitizeField(Dst->function, Src->function, sizeof(Dst->function), &Dst->function_truncated);
+
+    return Repaired;
+
+} /* End of ROS_APP_SanitizeRosout() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_SanitizeRosoutLong                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sanitizes a reassembled message in place.  The record fields come  */
+/*         from a fragment, so they need the same checks as a plain record.   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_SanitizeRosoutLong(ROS_APP_RosoutLong_Payload_t *Record)
+{
+    bool Repaired;
+
+    Record->name_truncated     = ROS_APP_SanitizeFlag(&Record->name_truncated);
+    Record->msg_truncated      = ROS_APP_SanitizeFlag(&Record->msg_truncated);
+    Record->file_truncated     = ROS_APP_SanitizeFlag(&Record->file_truncated);
+    Record->function_truncated = ROS_APP_SanitizeFlag(&Record->function_truncated);
+
+    Repaired = ROS_APP_SanitizeField(Record->name, Record->name, sizeof(Record->name), &Record->name_truncated);
+    Repaired |= ROS_APP_SanitizeField(Record->msg, Record->msg, sizeof(Record->msg), &Record->msg_truncated);
+    Repaired |= ROS_APP_SanitizeField(Record->file, Record->file, sizeof(Record->file), &Record->file_truncated);
+    Repaired |= ROS_APP_SanitizeField(Record->function, Record->function, sizeof(Record->function),
+                                      &Record->function_truncated);
+
+    return Repaired;
+
+} /* End of ROS_APP_SanitizeRosoutLong() */
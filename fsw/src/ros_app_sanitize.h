@@ -0,0 +1,58 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_sanitize.h
+**
+** Purpose:
+**   Validation and sanitization of /rosout text fields.
+**
+** Notes:
+**   A field ends at its first NUL.  A field without one is cut to leave
+**   room for a terminator and marked truncated, control characters
+**   before the end are replaced with ROS_APP_SANITIZE_REPLACEMENT, and
+**   the bytes after the end are cleared so nothing stale is forwarded.
+**   Bytes from 0x80 up are left alone so UTF-8 text passes through.
+**
+**   On SSE2 and NEON targets 16 bytes are checked at a time; everywhere
+**   else, or when ROS_APP_SANITIZE_SCALAR is defined, a byte loop gives
+**   the same result.  tools/ros_app_sanitize_bench.sh checks the two
+**   against each other on the host and times them.
+**
+*******************************************************************************/
+#ifndef _ros_app_sanitize_h_
+#define _ros_app_sanitize_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+
+#define ROS_APP_SANITIZE_REPLACEMENT '?'
+
+/*
+** Exported functions
+*/
+bool ROS_APP_SanitizeField(char *Dst, const char *Src, size_t Size, bool *Truncated);
+bool ROS_APP_SanitizeRosout(ROS_APP_Rosout_Payload_t *Dst, const ROS_APP_Rosout_Payload_t *Src);
+bool ROS_APP_SanitizeRosoutLong(ROS_APP_RosoutLong_Payload_t *Record);
+
+#endif /* _ros_app_sanitize_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,357 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_sched.c
+**
+** Purpose:
+**   Severity-priority downlink scheduler for forwarded /rosout packets.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_sched.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_SchedQueue_Copy                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Ring buffer copy helpers that handle wrap-around.                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static uint32 ROS_APP_SchedQueue_CopyIn(ROS_APP_SchedQueue_t *Queue, uint32 Offset, const void *Src, uint32 Bytes)
+{
+    uint32 First = ROS_APP_SCHED_QUEUE_BYTES - Offset;
+
+    if (First >= Bytes)
+    {
+        memcpy(&Queue->Data[Offset], Src, Bytes);
+    }
+    else
+    {
+        memcpy(&Queue->Data[Offset], Src, First);
+        memcpy(Queue->Data, (const uint8 *)Src + First, Bytes - First);
+    }
+
+    return (Offset + Bytes) % ROS_APP_SCHED_QUEUE_BYTES;
+}
+
+static uint32 ROS_APP_SchedQueue_CopyOut(const ROS_APP_SchedQueue_t *Queue, uint32 Offset, void *Dst, uint32 Bytes)
+{
+    uint32 First = ROS_APP_SCHED_QUEUE_BYTES - Offset;
+
+    if (First >= Bytes)
+    {
+        memcpy(Dst, &Queue->Data[Offset], Bytes);
+    }
+    else
+    {
+        memcpy(Dst, &Queue->Data[Offset], First);
+        memcpy((uint8 *)Dst + First, Queue->Data, Bytes - First);
+    }
+
+    return (Offset + Bytes) % ROS_APP_SCHED_QUEUE_BYTES;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_SchedQueue_HeadBytes                                       */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Size of the oldest packet in a queue, 0 when it is empty.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static uint32 ROS_APP_SchedQueue_HeadBytes(const ROS_APP_SchedQueue_t *Queue)
+{
+    uint32 Bytes = 0;
+
+    if (Queue->Packets > 0)
+    {
+        ROS_APP_SchedQueue_CopyOut(Queue, Queue->Head, &Bytes, sizeof(Bytes));
+    }
+
+    return Bytes;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sched_SendHead                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Removes the oldest packet of a class and sends it.                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+static uint32 ROS_APP_Sched_SendHead(ROS_APP_Sched_t *Sched, uint32 Class)
+{
+    ROS_APP_SchedQueue_t *Queue = &Sched->Queues[Class];
+    uint32                Bytes;
+
+    Queue->Head = ROS_APP_SchedQueue_CopyOut(Queue, Queue->Head, &Bytes, sizeof(Bytes));
+    Queue->Head = ROS_APP_SchedQueue_CopyOut(Queue, Queue->Head, Sched->SendBuf.Bytes, Bytes);
+
+    Queue->UsedBytes -= sizeof(Bytes) + Bytes;
+    Queue->Packets--;
+
+    CFE_SB_TransmitMsg(&Sched->SendBuf.SBBuf.Msg, !ROS_APP_Seq_Stamp(Sched->Seq, &Sched->SendBuf.SBBuf.Msg));
+    Sched->Tlm.Payload.Class[Class].Sent++;
+
+    return Bytes;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sched_Init                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Empties the queues and applies the default budget.  Packets        */
+/*         sent are numbered by Seq.                                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Sched_Init(ROS_APP_Sched_t *Sched, uint32 MidOffset, ROS_APP_Seq_t *Seq)
+{
+    static const uint8 DefaultWeights[ROS_APP_SEVERITY_COUNT] = {1, 2, 4, 0, 0};
+
+    memset(Sched, 0, sizeof(*Sched));
+    Sched->Seq = Seq;
+
+    CFE_MSG_Init(&Sched->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_SCHED_TLM_MID + MidOffset), sizeof(Sched->Tlm));
+
+    ROS_APP_Sched_Configure(Sched, ROS_APP_SCHED_DEFAULT_BYTES_PER_TICK, DefaultWeights);
+
+} /* End of ROS_APP_Sched_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sched_Configure                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sets the per-tick budget and the WARN/INFO/DEBUG weights.          */
+/*         Queued packets are kept.  A zero weight is treated as 1 so that    */
+/*         every class keeps making progress.                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Sched_Configure(ROS_APP_Sched_t *Sched, uint32 BytesPerTick, const uint8 *Weights)
+{
+    uint32 i;
+
+    Sched->BytesPerTick = BytesPerTick;
+
+    for (i = 0; i < ROS_APP_SEVERITY_COUNT; i++)
+    {
+        Sched->Weights[i] = (Weights[i] == 0) ? 1 : Weights[i];
+    }
+
+    Sched->Tlm.Payload.BytesPerTick = BytesPerTick;
+
+} /* End of ROS_APP_Sched_Configure() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sched_Enqueue                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Copies a complete SB packet onto the queue for its severity.       */
+/*         Returns false, and counts a drop, if it does not fit.              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_Sched_Enqueue(ROS_APP_Sched_t *Sched, uint8 Severity, const CFE_MSG_Message_t *MsgPtr)
+{
+    ROS_APP_SchedQueue_t *Queue;
+    CFE_MSG_Size_t        MsgSize = 0;
+    uint32                Bytes;
+
+    if (Severity >= ROS_APP_SEVERITY_COUNT)
+    {
+        Severity = ROS_APP_SEVERITY_FATAL;
+    }
+
+    Queue = &Sched->Queues[Severity];
+
+    CFE_MSG_GetSize(MsgPtr, &MsgSize);
+    Bytes = (uint32)MsgSize;
+
+    if (Bytes > ROS_APP_SCHED_MAX_PACKET_BYTES ||
+        Queue->UsedBytes + sizeof(Bytes) + Bytes > ROS_APP_SCHED_QUEUE_BYTES)
+    {
+        Sched->Tlm.Payload.Class[Severity].Dropped++;
+        return false;
+    }
+
+    Queue->Tail = ROS_APP_SchedQueue_CopyIn(Queue, Queue->Tail, &Bytes, sizeof(Bytes));
+    Queue->Tail = ROS_APP_SchedQueue_CopyIn(Queue, Queue->Tail, MsgPtr, Bytes);
+
+    Queue->UsedBytes += sizeof(Bytes) + Bytes;
+    Queue->Packets++;
+
+    return true;
+
+} /* End of ROS_APP_Sched_Enqueue() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sched_Tick                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends up to one tick's budget: strict priority for FATAL and       */
+/*         ERROR, then deficit round robin over WARN, INFO and DEBUG.  A      */
+/*         packet that does not fit the remaining budget waits for the next   */
+/*         tick rather than being skipped.                                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Sched_Tick(ROS_APP_Sched_t *Sched)
+{
+    ROS_APP_SchedQueue_t *Queue;
+    uint32                Remaining = Sched->BytesPerTick;
+    uint32                SentBytes = 0;
+    uint32                Head;
+    int32                 Class;
+    bool                  Blocked;
+
+    /*
+    ** Strict priority
+    */
+    for (Class = ROS_APP_SEVERITY_FATAL; Class >= ROS_APP_SEVERITY_ERROR; Class--)
+    {
+        while ((Head = ROS_APP_SchedQueue_HeadBytes(&Sched->Queues[Class])) != 0 && Head <= Remaining)
+        {
+            Head = ROS_APP_Sched_SendHead(Sched, Class);
+            Remaining -= Head;
+            SentBytes += Head;
+        }
+
+        if (Head != 0)
+        {
+            Remaining = 0; /* Lower classes must not overtake a waiting ERROR/FATAL */
+        }
+    }
+
+    /*
+    ** Weighted sharing.  Each round tops up the deficit of every backlogged
+    ** class; the loop ends when everything is sent or nothing more fits.
+    */
+    do
+    {
+        Blocked = true;
+
+        for (Class = ROS_APP_SEVERITY_WARN; Class >= ROS_APP_SEVERITY_DEBUG; Class--)
+        {
+            Queue = &Sched->Queues[Class];
+
+            Head = ROS_APP_SchedQueue_HeadBytes(Queue);
+            if (Head == 0)
+            {
+                Queue->Deficit = 0;
+                continue;
+            }
+
+            if (Head > Remaining)
+            {
+                continue;
+            }
+
+            Blocked = false;
+            Queue->Deficit += (uint32)Sched->Weights[Class] * ROS_APP_SCHED_QUANTUM_BYTES;
+
+            while (Head != 0 && Head <= Queue->Deficit && Head <= Remaining)
+            {
+                Queue->Deficit -= Head;
+                Remaining -= ROS_APP_Sched_SendHead(Sched, Class);
+                SentBytes += Head;
+                Head = ROS_APP_SchedQueue_HeadBytes(Queue);
+            }
+        }
+
+    } while (!Blocked);
+
+    Sched->Tlm.Payload.LastTickBytes = SentBytes;
+    if (Sched->Tlm.Payload.LastTickBytes > Sched->Tlm.Payload.MaxTickBytes)
+    {
+        Sched->Tlm.Payload.MaxTickBytes = Sched->Tlm.Payload.LastTickBytes;
+    }
+    Sched->Tlm.Payload.Ticks++;
+
+} /* End of ROS_APP_Sched_Tick() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sched_FillPct                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the occupancy of the fullest class queue, in percent.      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint8 ROS_APP_Sched_FillPct(const ROS_APP_Sched_t *Sched)
+{
+    uint32 Used = 0;
+    uint32 i;
+
+    for (i = 0; i < ROS_APP_SEVERITY_COUNT; i++)
+    {
+        if (Sched->Queues[i].UsedBytes > Used)
+        {
+            Used = Sched->Queues[i].UsedBytes;
+        }
+    }
+
+    return (uint8)(((uint64)Used * 100) / ROS_APP_SCHED_QUEUE_BYTES);
+
+} /* End of ROS_APP_Sched_FillPct() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sched_SendTlm                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends queue depths, per-class counts and budget usage.             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Sched_SendTlm(ROS_APP_Sched_t *Sched)
+{
+    uint32 i;
+
+    for (i = 0; i < ROS_APP_SEVERITY_COUNT; i++)
+    {
+        Sched->Tlm.Payload.Class[i].QueuedPackets = Sched->Queues[i].Packets;
+        Sched->Tlm.Payload.Class[i].QueuedBytes   = Sched->Queues[i].UsedBytes;
+    }
+
+    CFE_SB_TimeStampMsg(&Sched->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Sched->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_Sched_SendTlm() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Sched_ResetStats                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the per-class counts and tick statistics, keeping whatever  */
+/*         is queued.                                                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Sched_ResetStats(ROS_APP_Sched_t *Sched)
+{
+    uint32 i;
+
+    for (i = 0; i < ROS_APP_SEVERITY_COUNT; i++)
+    {
+        Sched->Tlm.Payload.Class[i].Sent    = 0;
+        Sched->Tlm.Payload.Class[i].Dropped = 0;
+    }
+
+    Sched->Tlm.Payload.MaxTickBytes = 0;
+    Sched->Tlm.Payload.Ticks        = 0;
+
+} /* End of ROS_APP_Sched_ResetStats() */
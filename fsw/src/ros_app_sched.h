@@ -0,0 +1,100 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_sched.h
+**
+** Purpose:
+**   Severity-priority downlink scheduler for forwarded /rosout packets.
+**
+** Notes:
+**   Each severity class has its own byte queue of complete SB packets.  On
+**   every tick the scheduler sends at most BytesPerTick bytes: FATAL and
+**   ERROR drain first in strict priority, then WARN, INFO and DEBUG share
+**   what is left by deficit round robin in proportion to their weights.
+**   A full queue drops the newest packet and counts it against its class.
+**
+*******************************************************************************/
+#ifndef _ros_app_sched_h_
+#define _ros_app_sched_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+#include "ros_app_seq.h"
+
+/*
+** One severity class queue.  Entries are a uint32 length followed by the
+** packet, and may wrap around the end of Data.
+*/
+typedef struct
+{
+    uint8  Data[ROS_APP_SCHED_QUEUE_BYTES];
+    uint32 Head;
+    uint32 Tail;
+    uint32 UsedBytes;
+    uint32 Packets;
+    uint32 Deficit;
+
+} ROS_APP_SchedQueue_t;
+
+/*
+** Scheduler state
+*/
+typedef struct
+{
+    ROS_APP_SchedQueue_t Queues[ROS_APP_SEVERITY_COUNT];
+
+    uint32 BytesPerTick;
+    uint8  Weights[ROS_APP_SEVERITY_COUNT];
+
+    /*
+    ** Aligned copy of the packet being sent
+    */
+    union
+    {
+        CFE_SB_Buffer_t SBBuf;
+        uint8           Bytes[ROS_APP_SCHED_MAX_PACKET_BYTES];
+    } SendBuf;
+
+    /*
+    ** Numbers the packets as they leave
+    */
+    ROS_APP_Seq_t *Seq;
+
+    ROS_APP_SchedTlm_t Tlm;
+
+} ROS_APP_Sched_t;
+
+/*
+** Exported functions
+*/
+void  ROS_APP_Sched_Init(ROS_APP_Sched_t *Sched, uint32 MidOffset, ROS_APP_Seq_t *Seq);
+void  ROS_APP_Sched_Configure(ROS_APP_Sched_t *Sched, uint32 BytesPerTick, const uint8 *Weights);
+bool  ROS_APP_Sched_Enqueue(ROS_APP_Sched_t *Sched, uint8 Severity, const CFE_MSG_Message_t *MsgPtr);
+void  ROS_APP_Sched_Tick(ROS_APP_Sched_t *Sched);
+uint8 ROS_APP_Sched_FillPct(const ROS_APP_Sched_t *Sched);
+void  ROS_APP_Sched_SendTlm(ROS_APP_Sched_t *Sched);
+void  ROS_APP_Sched_ResetStats(ROS_APP_Sched_t *Sched);
+
+#endif /* _ros_app_sched_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,206 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_seq.c
+**
+** Purpose:
+**   Sequence gap detection on /rosout ingest and sequence counts on the
+**   log products sent for downlink.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_seq.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Seq_Gap                                                    */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Accounts for a packet that is not the one expected.  Returns true  */
+/*         if the sequence should continue from it.                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool ROS_APP_Seq_Gap(ROS_APP_Seq_t *Seq, uint32 Stream, uint16 Count)
+{
+    ROS_APP_SeqInTlm_t *Stat = &Seq->Tlm.Payload.In[Stream];
+    uint16              Gap;
+
+    Gap = (Count - Seq->Expected[Stream]) & ROS_APP_SEQ_COUNT_MASK;
+    if (Gap > ROS_APP_SEQ_COUNT_MASK / 2)
+    {
+        Stat->OutOfOrder++;
+
+        /*
+        ** A run of late packets is a restarted sender, not reordering
+        */
+        if (++Seq->Behind[Stream] < ROS_APP_SEQ_RESYNC_PACKETS)
+        {
+            return false;
+        }
+
+        Stat->Gaps++;
+        return true;
+    }
+
+    Stat->Lost += Gap;
+    Stat->Gaps++;
+    if (Gap > Stat->MaxGap)
+    {
+        Stat->MaxGap = Gap;
+    }
+
+    return true;
+
+} /* End of ROS_APP_Seq_Gap() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Seq_Init                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Waits for the first packet on each stream.                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Seq_Init(ROS_APP_Seq_t *Seq, uint32 MidOffset)
+{
+    memset(Seq, 0, sizeof(*Seq));
+
+    CFE_MSG_Init(&Seq->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_SEQ_TLM_MID + MidOffset), sizeof(Seq->Tlm));
+
+} /* End of ROS_APP_Seq_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Seq_Check                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Checks an incoming packet's sequence count.  Stream is the index   */
+/*         into the In[] telemetry.                                           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Seq_Check(ROS_APP_Seq_t *Seq, uint32 Stream, const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_SequenceCount_t Count = 0;
+
+    CFE_MSG_GetSequenceCount(MsgPtr, &Count);
+
+    Seq->Tlm.Payload.In[Stream].Received++;
+    Seq->Tlm.Payload.In[Stream].LastSeq = Count;
+
+    if (!Seq->Synced[Stream])
+    {
+        Seq->Synced[Stream] = true;
+    }
+    else if (Count != Seq->Expected[Stream] && !ROS_APP_Seq_Gap(Seq, Stream, Count))
+    {
+        return;
+    }
+
+    Seq->Behind[Stream]   = 0;
+    Seq->Expected[Stream] = (Count + 1) & ROS_APP_SEQ_COUNT_MASK;
+
+} /* End of ROS_APP_Seq_Check() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Seq_Stamp                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sets the sequence count of an outgoing log product.  Returns false */
+/*         if the product table is full and SB should number it instead.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_Seq_Stamp(ROS_APP_Seq_t *Seq, CFE_MSG_Message_t *MsgPtr)
+{
+    ROS_APP_SeqOutTlm_t *Out;
+    CFE_SB_MsgId_t       MsgId = CFE_SB_INVALID_MSG_ID;
+    uint32               MidValue;
+    uint32               i;
+
+    CFE_MSG_GetMsgId(MsgPtr, &MsgId);
+    MidValue = CFE_SB_MsgIdToValue(MsgId);
+
+    for (i = 0; i < ROS_APP_SEQ_MAX_PRODUCTS; i++)
+    {
+        Out = &Seq->Tlm.Payload.Out[i];
+        if (Out->MsgId == MidValue || Out->MsgId == 0)
+        {
+            Out->MsgId   = MidValue;
+            Out->LastSeq = Seq->Next[i];
+            Out->Sent++;
+
+            CFE_MSG_SetSequenceCount(MsgPtr, Seq->Next[i]);
+            Seq->Next[i] = (Seq->Next[i] + 1) & ROS_APP_SEQ_COUNT_MASK;
+
+            return true;
+        }
+    }
+
+    return false;
+
+} /* End of ROS_APP_Seq_Stamp() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Seq_ResetStats                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the loss and send counts.  Sequencing carries on.           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Seq_ResetStats(ROS_APP_Seq_t *Seq)
+{
+    uint32 i;
+
+    memset(Seq->Tlm.Payload.In, 0, sizeof(Seq->Tlm.Payload.In));
+
+    for (i = 0; i < ROS_APP_SEQ_MAX_PRODUCTS; i++)
+    {
+        Seq->Tlm.Payload.Out[i].Sent = 0;
+    }
+
+} /* End of ROS_APP_Seq_ResetStats() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Seq_SendTlm                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Updates the loss rates and sends the sequence telemetry.           */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Seq_SendTlm(ROS_APP_Seq_t *Seq)
+{
+    ROS_APP_SeqInTlm_t *Stat;
+    uint64              Total;
+    uint32              i;
+
+    for (i = 0; i < ROS_APP_SEQ_IN_STREAMS; i++)
+    {
+        Stat  = &Seq->Tlm.Payload.In[i];
+        Total = (uint64)Stat->Lost + Stat->Received;
+
+        Stat->LossBp = (Total == 0) ? 0 : (uint16)(((uint64)Stat->Lost * 10000) / Total);
+    }
+
+    CFE_SB_TimeStampMsg(&Seq->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Seq->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_Seq_SendTlm() */
@@ -0,0 +1,80 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_seq.h
+**
+** Purpose:
+**   Sequence gap detection on /rosout ingest and sequence counts on the
+**   log products sent for downlink.
+**
+** Notes:
+**   Incoming packets are checked against the CCSDS sequence count expected
+**   on their MID.  A count ahead of it is counted as loss, one behind it
+**   (within half the counter range) as a late or repeated packet, which
+**   leaves the expected count alone.  The first packet on each MID only
+**   sets the expected count.  A bridge restart usually lands behind the
+**   expected count: its first ROS_APP_SEQ_RESYNC_PACKETS packets are
+**   counted late, the sequence is followed on from the last of them, and
+**   the restart is counted as one gap with no loss.
+**
+**   Log products leaving the scheduler are numbered per MID by this app
+**   rather than by SB, so a break in the numbers on the ground means the
+**   packet was lost after ros_app sent it.  Only the first
+**   ROS_APP_SEQ_MAX_PRODUCTS MIDs seen get their own counts; any others
+**   are left to SB.
+**
+*******************************************************************************/
+#ifndef _ros_app_seq_h_
+#define _ros_app_seq_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+
+#define ROS_APP_SEQ_COUNT_MASK 0x3FFF /* CCSDS primary header sequence count */
+
+/*
+** Sequence state.  The counts themselves are kept across counter resets.
+*/
+typedef struct
+{
+    uint16 Expected[ROS_APP_SEQ_IN_STREAMS];
+    bool   Synced[ROS_APP_SEQ_IN_STREAMS];
+    uint16 Behind[ROS_APP_SEQ_IN_STREAMS]; /* Late packets in a row */
+    uint16 Next[ROS_APP_SEQ_MAX_PRODUCTS];
+
+    ROS_APP_SeqTlm_t Tlm;
+
+} ROS_APP_Seq_t;
+
+/*
+** Exported functions
+*/
+void ROS_APP_Seq_Init(ROS_APP_Seq_t *Seq, uint32 MidOffset);
+void ROS_APP_Seq_Check(ROS_APP_Seq_t *Seq, uint32 Stream, const CFE_MSG_Message_t *MsgPtr);
+bool ROS_APP_Seq_Stamp(ROS_APP_Seq_t *Seq, CFE_MSG_Message_t *MsgPtr);
+void ROS_APP_Seq_ResetStats(ROS_APP_Seq_t *Seq);
+void ROS_APP_Seq_SendTlm(ROS_APP_Seq_t *Seq);
+
+#endif /* _ros_app_seq_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,209 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_tasks.c
+**
+** Purpose:
+**   Registry of periodic work run from the ros App main loop.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_events.h"
+#include "ros_app_msgids.h"
+#include "ros_app_tasks.h"
+#include "ros_app_utils.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tasks_Init                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Empties the registry.                                              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void ROS_APP_Tasks_Init(ROS_APP_Tasks_t *Tasks, uint32 MidOffset)
+{
+    memset(Tasks, 0, sizeof(*Tasks));
+
+    Tasks->NextDueUsec = UINT64_MAX;
+
+    CFE_MSG_Init(&Tasks->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_TASKS_TLM_MID + MidOffset), sizeof(Tasks->Tlm));
+
+} /* End of ROS_APP_Tasks_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tasks_Register                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Adds a task that runs every PeriodMs, first one period from now.   */
+/*         Returns CFE_SUCCESS or CFE_STATUS_NOT_IMPLEMENTED when the         */
+/*         registry is full or the arguments are unusable.                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+int32 ROS_APP_Tasks_Register(ROS_APP_Tasks_t *Tasks, const char *Name, ROS_APP_TaskFunc_t Func, void *Arg,
+                             uint32 PeriodMs, uint32 BudgetUsec)
+{
+    ROS_APP_PeriodicTask_t *Task;
+    ROS_APP_TaskTlm_t      *Stats;
+
+    if (Tasks->Count >= ROS_APP_MAX_PERIODIC_TASKS || Func == NULL || PeriodMs == 0)
+    {
+        return CFE_STATUS_NOT_IMPLEMENTED;
+    }
+
+    Task  = &Tasks->Tasks[Tasks->Count];
+    Stats = &Tasks->Tlm.Payload.Task[Tasks->Count];
+
+    Task->Func        = Func;
+    Task->Arg         = Arg;
+    Task->NextDueUsec = ROS_APP_GetTimeUsec() + ((uint64)PeriodMs * 1000);
+    Task->TotalUsec   = 0;
+
+    strncpy(Stats->Name, Name, sizeof(Stats->Name) - 1);
+    Stats->PeriodMs   = PeriodMs;
+    Stats->BudgetUsec = BudgetUsec;
+
+    if (Task->NextDueUsec < Tasks->NextDueUsec)
+    {
+        Tasks->NextDueUsec = Task->NextDueUsec;
+    }
+
+    Tasks->Count++;
+
+    return CFE_SUCCESS;
+
+} /* End of ROS_APP_Tasks_Register() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tasks_RunDue                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Runs every task whose period has elapsed.  Costs one compare when  */
+/*         nothing is due, so it can be called after every packet.  A task    */
+/*         that fell more than a period behind skips the missed runs.         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Tasks_RunDue(ROS_APP_Tasks_t *Tasks, uint64 Now)
+{
+    ROS_APP_PeriodicTask_t *Task;
+    ROS_APP_TaskTlm_t      *Stats;
+    uint64                  Period;
+    uint64                  Start;
+    uint32                  Elapsed;
+    uint32                  i;
+
+    if (Now < Tasks->NextDueUsec)
+    {
+        return;
+    }
+
+    Tasks->NextDueUsec = UINT64_MAX;
+
+    for (i = 0; i < Tasks->Count; i++)
+    {
+        Task   = &Tasks->Tasks[i];
+        Stats  = &Tasks->Tlm.Payload.Task[i];
+        Period = (uint64)Stats->PeriodMs * 1000;
+
+        if (Now >= Task->NextDueUsec)
+        {
+            Start = ROS_APP_GetTimeUsec();
+            Task->Func(Task->Arg);
+            Elapsed = (uint32)(ROS_APP_GetTimeUsec() - Start);
+
+            Task->TotalUsec += Elapsed;
+            Stats->Runs++;
+            Stats->LastUsec = Elapsed;
+            Stats->AvgUsec  = (uint32)(Task->TotalUsec / Stats->Runs);
+            if (Elapsed > Stats->MaxUsec)
+            {
+                Stats->MaxUsec = Elapsed;
+            }
+
+            if (Stats->BudgetUsec > 0 && Elapsed > Stats->BudgetUsec)
+            {
+                if (Stats->Overruns == 0)
+                {
+                    CFE_EVS_SendEvent(ROS_APP_TASK_OVERRUN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "ros: periodic task %s took %lu usec, budget %lu usec", Stats->Name,
+                                      (unsigned long)Elapsed, (unsigned long)Stats->BudgetUsec);
+                }
+                Stats->Overruns++;
+            }
+
+            Task->NextDueUsec += Period;
+            if (Task->NextDueUsec <= Now)
+            {
+                Task->NextDueUsec = Now + Period;
+            }
+        }
+
+        if (Task->NextDueUsec < Tasks->NextDueUsec)
+        {
+            Tasks->NextDueUsec = Task->NextDueUsec;
+        }
+    }
+
+} /* End of ROS_APP_Tasks_RunDue() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tasks_ResetStats                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears run statistics, keeping the registrations.                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Tasks_ResetStats(ROS_APP_Tasks_t *Tasks)
+{
+    uint32 i;
+
+    Tasks->Tlm.Payload.Wakeups  = 0;
+    Tasks->Tlm.Payload.Timeouts = 0;
+
+    for (i = 0; i < Tasks->Count; i++)
+    {
+        Tasks->Tasks[i].TotalUsec = 0;
+
+        Tasks->Tlm.Payload.Task[i].Runs     = 0;
+        Tasks->Tlm.Payload.Task[i].Overruns = 0;
+        Tasks->Tlm.Payload.Task[i].LastUsec = 0;
+        Tasks->Tlm.Payload.Task[i].MaxUsec  = 0;
+        Tasks->Tlm.Payload.Task[i].AvgUsec  = 0;
+    }
+
+} /* End of ROS_APP_Tasks_ResetStats() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tasks_SendTlm                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the periodic task accounting packet.                         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Tasks_SendTlm(ROS_APP_Tasks_t *Tasks)
+{
+    CFE_SB_TimeStampMsg(&Tasks->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Tasks->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_Tasks_SendTlm() */
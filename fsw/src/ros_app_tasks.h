@@ -0,0 +1,80 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_tasks.h
+**
+** Purpose:
+**   Registry of periodic work run from the ros App main loop.
+**
+** Notes:
+**   Tasks run in the main task between packets, so each one must be short.
+**   Every run is timed against the task's budget; overruns are counted and
+**   the first one per task raises an event.  Run statistics go out in
+**   ROS_APP_TASKS_TLM_MID.
+**
+*******************************************************************************/
+#ifndef _ros_app_tasks_h_
+#define _ros_app_tasks_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+
+typedef void (*ROS_APP_TaskFunc_t)(void *Arg);
+
+/*
+** One periodic task
+*/
+typedef struct
+{
+    ROS_APP_TaskFunc_t Func;
+    void              *Arg;
+    uint64             NextDueUsec;
+    uint64             TotalUsec;
+
+} ROS_APP_PeriodicTask_t;
+
+/*
+** Registry state
+*/
+typedef struct
+{
+    ROS_APP_PeriodicTask_t Tasks[ROS_APP_MAX_PERIODIC_TASKS];
+    uint32                 Count;
+    uint64                 NextDueUsec; /* Earliest NextDueUsec of all tasks */
+
+    ROS_APP_TasksTlm_t Tlm;
+
+} ROS_APP_Tasks_t;
+
+/*
+** Exported functions
+*/
+void  ROS_APP_Tasks_Init(ROS_APP_Tasks_t *Tasks, uint32 MidOffset);
+int32 ROS_APP_Tasks_Register(ROS_APP_Tasks_t *Tasks, const char *Name, ROS_APP_TaskFunc_t Func, void *Arg,
+                             uint32 PeriodMs, uint32 BudgetUsec);
+void  ROS_APP_Tasks_RunDue(ROS_APP_Tasks_t *Tasks, uint64 Now);
+void  ROS_APP_Tasks_ResetStats(ROS_APP_Tasks_t *Tasks);
+void  ROS_APP_Tasks_SendTlm(ROS_APP_Tasks_t *Tasks);
+
+#endif /* _ros_app_tasks_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
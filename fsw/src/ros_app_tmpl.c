@@ -0,0 +1,672 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_tmpl.c
+**
+** Purpose:
+**   Online template extraction for /rosout msg text.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_msgids.h"
+#include "ros_app_tmpl.h"
+#include "ros_app_utils.h"
+
+#include <string.h>
+
+#define ROS_APP_TMPL_IS_DIGIT(c) ((c) >= '0' && (c) <= '9')
+#define ROS_APP_TMPL_IS_LOWER_HEX(c) ((c) >= 'a' && (c) <= 'f')
+#define ROS_APP_TMPL_IS_UPPER_HEX(c) ((c) >= 'A' && (c) <= 'F')
+#define ROS_APP_TMPL_IS_WORD(c)                                                                       \
+    (ROS_APP_TMPL_IS_DIGIT(c) || ((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z') || (c) == '_')
+
+/*
+** Longest token that is turned into a parameter; the RAW tag holds its length
+*/
+#define ROS_APP_TMPL_MAX_TOKEN_BYTES ROS_APP_TMPL_TAG_ARG_MASK
+
+/*
+** Digits that always fit an int32 mantissa
+*/
+#define ROS_APP_TMPL_MAX_DEC_DIGITS 9
+#define ROS_APP_TMPL_MAX_HEX_DIGITS 8
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_PutVarint / ROS_APP_Tmpl_GetVarint                    */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Base 128 varints, least significant group first.                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint32 ROS_APP_Tmpl_PutVarint(uint8 *Out, uint32 Value)
+{
+    uint32 Bytes = 0;
+
+    while (Value >= 0x80)
+    {
+        Out[Bytes++] = (uint8)(Value | 0x80);
+        Value >>= 7;
+    }
+    Out[Bytes++] = (uint8)Value;
+
+    return Bytes;
+}
+
+static bool ROS_APP_Tmpl_GetVarint(const uint8 *In, uint32 InBytes, uint32 *Pos, uint32 *Value)
+{
+    uint32 Shift = 0;
+    uint8  Byte;
+
+    *Value = 0;
+    do
+    {
+        if (*Pos >= InBytes || Shift > 28)
+        {
+            return false;
+        }
+        Byte = In[(*Pos)++];
+        *Value |= (uint32)(Byte & 0x7F) << Shift;
+        Shift += 7;
+    } while (Byte & 0x80);
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_TokenEnd                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the end of the numeric or hex token starting at Pos, or    */
+/*         Pos if there is none.  A token must stand alone: "x86", "v1.2.3"   */
+/*         and "3rd" stay in the template text.                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint32 ROS_APP_Tmpl_TokenEnd(const char *Msg, uint32 Len, uint32 Pos)
+{
+    uint32 i = Pos;
+    uint32 Start;
+
+    if (Pos > 0 && (ROS_APP_TMPL_IS_WORD(Msg[Pos - 1]) || Msg[Pos - 1] == '.'))
+    {
+        return Pos;
+    }
+
+    if (Msg[i] == '-')
+    {
+        i++;
+    }
+    if (i >= Len || !ROS_APP_TMPL_IS_DIGIT(Msg[i]))
+    {
+        return Pos;
+    }
+
+    if (i == Pos && Msg[i] == '0' && i + 1 < Len && Msg[i + 1] == 'x')
+    {
+        i += 2;
+        Start = i;
+        while (i < Len &&
+               (ROS_APP_TMPL_IS_DIGIT(Msg[i]) || ROS_APP_TMPL_IS_LOWER_HEX(Msg[i]) || ROS_APP_TMPL_IS_UPPER_HEX(Msg[i])))
+        {
+            i++;
+        }
+        if (i == Start)
+        {
+            return Pos;
+        }
+    }
+    else
+    {
+        while (i < Len && ROS_APP_TMPL_IS_DIGIT(Msg[i]))
+        {
+            i++;
+        }
+        if (i + 1 < Len && Msg[i] == '.' && ROS_APP_TMPL_IS_DIGIT(Msg[i + 1]))
+        {
+            i++;
+            while (i < Len && ROS_APP_TMPL_IS_DIGIT(Msg[i]))
+            {
+                i++;
+            }
+        }
+    }
+
+    if (i < Len && (ROS_APP_TMPL_IS_WORD(Msg[i]) || (Msg[i] == '.' && i + 1 < Len && ROS_APP_TMPL_IS_DIGIT(Msg[i + 1]))))
+    {
+        return Pos;
+    }
+    if (i - Pos > ROS_APP_TMPL_MAX_TOKEN_BYTES)
+    {
+        return Pos;
+    }
+
+    return i;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_PackParam                                             */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Packs one token in the smallest form that rebuilds it exactly.     */
+/*         The result is never longer than the token plus its tag.            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint32 ROS_APP_Tmpl_PackParam(const char *Tok, uint32 TokBytes, uint8 *Out)
+{
+    bool   Negative = (Tok[0] == '-');
+    uint32 i        = Negative ? 1 : 0;
+    uint32 IntDigits;
+    uint32 FracDigits = 0;
+    uint32 Value      = 0;
+    uint32 Upper      = 0;
+    uint32 Lower      = 0;
+    int32  Signed;
+
+    if (TokBytes > 2 && Tok[0] == '0' && Tok[1] == 'x')
+    {
+        if (TokBytes - 2 > ROS_APP_TMPL_MAX_HEX_DIGITS)
+        {
+            goto raw;
+        }
+        for (i = 2; i < TokBytes; i++)
+        {
+            if (ROS_APP_TMPL_IS_DIGIT(Tok[i]))
+            {
+                Value = (Value << 4) | (uint32)(Tok[i] - '0');
+            }
+            else if (ROS_APP_TMPL_IS_LOWER_HEX(Tok[i]))
+            {
+                Value = (Value << 4) | (uint32)(Tok[i] - 'a' + 10);
+                Lower = 1;
+            }
+            else
+            {
+                Value = (Value << 4) | (uint32)(Tok[i] - 'A' + 10);
+                Upper = 1;
+            }
+        }
+        if (Upper && Lower)
+        {
+            goto raw;
+        }
+        Out[0] = ROS_APP_TMPL_TAG_HEX | (Upper ? ROS_APP_TMPL_HEX_UPPER : 0) | (uint8)(TokBytes - 2);
+        return 1 + ROS_APP_Tmpl_PutVarint(&Out[1], Value);
+    }
+
+    for (IntDigits = 0; i < TokBytes && Tok[i] != '.'; i++, IntDigits++)
+    {
+        Value = Value * 10 + (uint32)(Tok[i] - '0');
+    }
+    if (i < TokBytes)
+    {
+        for (i++; i < TokBytes; i++, FracDigits++)
+        {
+            Value = Value * 10 + (uint32)(Tok[i] - '0');
+        }
+    }
+
+    /*
+    ** Forms the digit string alone cannot restore go out as text
+    */
+    if (IntDigits + FracDigits > ROS_APP_TMPL_MAX_DEC_DIGITS ||
+        (IntDigits > 1 && Tok[Negative ? 1 : 0] == '0') || (Negative && Value == 0))
+    {
+        goto raw;
+    }
+
+    Signed = Negative ? -(int32)Value : (int32)Value;
+    Out[0] = (FracDigits == 0) ? ROS_APP_TMPL_TAG_INT : (ROS_APP_TMPL_TAG_DEC | (uint8)FracDigits);
+    return 1 + ROS_APP_Tmpl_PutVarint(&Out[1], ((uint32)Signed << 1) ^ (uint32)(Signed >> 31));
+
+raw:
+    Out[0] = ROS_APP_TMPL_TAG_RAW | (uint8)TokBytes;
+    memcpy(&Out[1], Tok, TokBytes);
+    return 1 + TokBytes;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_Init                                                  */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Empties the template table.                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Tmpl_Init(ROS_APP_Tmpl_t *Tmpl, uint32 MidOffset)
+{
+    uint32 i;
+
+    memset(Tmpl, 0, sizeof(*Tmpl));
+
+    for (i = 0; i < ROS_APP_TMPL_HASH_BUCKETS; i++)
+    {
+        Tmpl->Buckets[i] = ROS_APP_TMPL_NO_ENTRY;
+    }
+
+    CFE_MSG_Init(&Tmpl->Tlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(ROS_APP_TMPL_TLM_MID + MidOffset), sizeof(Tmpl->Tlm));
+
+} /* End of ROS_APP_Tmpl_Init() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_Allocate                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Finds a slot for a new template, evicting with the clock hand when */
+/*         the table is full.                                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint16 ROS_APP_Tmpl_Allocate(ROS_APP_Tmpl_t *Tmpl)
+{
+    ROS_APP_TmplEntry_t *Entry;
+    uint16              *Link;
+    uint16               Index;
+
+    while (true)
+    {
+        Index           = (uint16)Tmpl->ClockHand;
+        Tmpl->ClockHand = (Tmpl->ClockHand + 1) % ROS_APP_TMPL_MAX_TEMPLATES;
+        Entry           = &Tmpl->Entries[Index];
+
+        if (!Entry->InUse)
+        {
+            Tmpl->Tlm.Payload.TemplatesInUse++;
+            return Index;
+        }
+
+        if (Entry->Referenced)
+        {
+            Entry->Referenced = false;
+            continue;
+        }
+
+        /*
+        ** Unlink the victim from its bucket
+        */
+        Link = &Tmpl->Buckets[Entry->Hash & (ROS_APP_TMPL_HASH_BUCKETS - 1)];
+        while (*Link != Index)
+        {
+            Link = &Tmpl->Entries[*Link].NextInBucket;
+        }
+        *Link = Entry->NextInBucket;
+
+        Entry->Generation++;
+        Tmpl->Tlm.Payload.Evictions++;
+        return Index;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_Encode                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Splits a msg into its template and packed parameters, adding the   */
+/*         template to the table if it is new.  NeedsDef is set when the      */
+/*         template has not been announced with ROS_APP_Tmpl_SetAnnounced.    */
+/*         Returns false if the msg cannot be templated.                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_Tmpl_Encode(ROS_APP_Tmpl_t *Tmpl, const char *Msg, uint32 MsgBytes, ROS_APP_TmplRef_t *Ref,
+                         uint8 *Params, uint16 *ParamBytes, bool *NeedsDef)
+{
+    ROS_APP_TmplEntry_t *Entry;
+    uint32               Len        = 0;
+    uint32               TextBytes  = 0;
+    uint32               Packed     = 0;
+    uint32               ParamCount = 0;
+    uint32               Pos;
+    uint32               End;
+    uint32               Hash;
+    uint16               Index;
+
+    Tmpl->Tlm.Payload.Records++;
+
+    while (Len < MsgBytes && Msg[Len] != 0)
+    {
+        Len++;
+    }
+
+    if (memchr(Msg, ROS_APP_TMPL_SLOT, Len) != NULL)
+    {
+        Tmpl->Tlm.Payload.Untemplatable++;
+        return false;
+    }
+
+    for (Pos = 0; Pos < Len;)
+    {
+        End = Pos;
+        if (ROS_APP_TMPL_IS_DIGIT(Msg[Pos]) || Msg[Pos] == '-')
+        {
+            End = ROS_APP_Tmpl_TokenEnd(Msg, Len, Pos);
+        }
+
+        if (End == Pos)
+        {
+            Tmpl->Text[TextBytes++] = Msg[Pos++];
+            continue;
+        }
+
+        if (ParamCount == ROS_APP_TMPL_MAX_PARAMS)
+        {
+            Tmpl->Tlm.Payload.Untemplatable++;
+            return false;
+        }
+
+        Tmpl->Text[TextBytes++] = ROS_APP_TMPL_SLOT;
+        Packed += ROS_APP_Tmpl_PackParam(&Msg[Pos], End - Pos, &Params[Packed]);
+        ParamCount++;
+        Pos = End;
+    }
+
+    /*
+    ** Look the template up, or add it
+    */
+    Hash  = ROS_APP_HashName(Tmpl->Text, TextBytes);
+    Index = Tmpl->Buckets[Hash & (ROS_APP_TMPL_HASH_BUCKETS - 1)];
+    while (Index != ROS_APP_TMPL_NO_ENTRY)
+    {
+        Entry = &Tmpl->Entries[Index];
+        if (Entry->Hash == Hash && Entry->TextBytes == TextBytes && memcmp(Entry->Text, Tmpl->Text, TextBytes) == 0)
+        {
+            break;
+        }
+        Index = Entry->NextInBucket;
+    }
+
+    if (Index != ROS_APP_TMPL_NO_ENTRY)
+    {
+        Entry->Referenced = true;
+        Tmpl->Tlm.Payload.Hits++;
+    }
+    else
+    {
+        Index = ROS_APP_Tmpl_Allocate(Tmpl);
+        Entry = &Tmpl->Entries[Index];
+
+        Entry->Hash       = Hash;
+        Entry->TextBytes  = TextBytes;
+        Entry->ParamCount = ParamCount;
+        Entry->Referenced = false;
+        Entry->Announced  = false;
+        Entry->InUse      = true;
+        Entry->Hits       = 0;
+        memcpy(Entry->Text, Tmpl->Text, TextBytes);
+
+        Entry->NextInBucket                                 = Tmpl->Buckets[Hash & (ROS_APP_TMPL_HASH_BUCKETS - 1)];
+        Tmpl->Buckets[Hash & (ROS_APP_TMPL_HASH_BUCKETS - 1)] = Index;
+
+        Tmpl->Tlm.Payload.NewTemplates++;
+    }
+
+    Entry->Hits++;
+
+    Ref->TemplateId = Index;
+    Ref->Generation = Entry->Generation;
+    *ParamBytes     = Packed;
+    *NeedsDef       = !Entry->Announced;
+
+    Tmpl->Tlm.Payload.Encoded++;
+    Tmpl->Tlm.Payload.BytesIn += Len;
+    Tmpl->Tlm.Payload.BytesOut += sizeof(*Ref) + sizeof(*ParamBytes) + Packed;
+
+    return true;
+
+} /* End of ROS_APP_Tmpl_Encode() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_Expand                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Rebuilds the original msg from template text and packed            */
+/*         parameters.  Uses nothing but its arguments, so ground tools can   */
+/*         call it with definitions from ROS_APP_TMPL_DEF_MID.  Out is NUL    */
+/*         terminated; returns false on malformed input or if Out is too      */
+/*         small.                                                             */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_Tmpl_Expand(const char *Text, uint32 TextBytes, const uint8 *Params, uint32 ParamBytes, char *Out,
+                         uint32 OutSize)
+{
+    char        Digits[ROS_APP_TMPL_MAX_DEC_DIGITS + 1];
+    const char *Hex;
+    uint32      OutBytes = 0;
+    uint32      Pos      = 0;
+    uint32      NDigits;
+    uint32      Width;
+    uint32      Point;
+    uint32      Value;
+    uint32      i;
+    uint32      t;
+    uint8       Tag;
+    uint8       Arg;
+    bool        Negative;
+
+    for (t = 0; t < TextBytes; t++)
+    {
+        if (Text[t] != ROS_APP_TMPL_SLOT)
+        {
+            if (OutBytes + 1 >= OutSize)
+            {
+                return false;
+            }
+            Out[OutBytes++] = Text[t];
+            continue;
+        }
+
+        if (Pos >= ParamBytes)
+        {
+            return false;
+        }
+        Tag = Params[Pos] & ROS_APP_TMPL_TAG_TYPE_MASK;
+        Arg = Params[Pos] & ROS_APP_TMPL_TAG_ARG_MASK;
+        Pos++;
+
+        if (Tag == ROS_APP_TMPL_TAG_RAW)
+        {
+            if (Pos + Arg > ParamBytes || OutBytes + Arg >= OutSize)
+            {
+                return false;
+            }
+            memcpy(&Out[OutBytes], &Params[Pos], Arg);
+            OutBytes += Arg;
+            Pos += Arg;
+            continue;
+        }
+
+        if (!ROS_APP_Tmpl_GetVarint(Params, ParamBytes, &Pos, &Value))
+        {
+            return false;
+        }
+
+        /*
+        ** Build the digits least significant first, padded to the width
+        ** the tag calls for, then copy them out behind any sign or prefix
+        */
+        Negative = false;
+        Point    = 0;
+        if (Tag == ROS_APP_TMPL_TAG_HEX)
+        {
+            Hex   = (Arg & ROS_APP_TMPL_HEX_UPPER) ? "0123456789ABCDEF" : "0123456789abcdef";
+            Width = Arg & ~ROS_APP_TMPL_HEX_UPPER;
+            if (Width > ROS_APP_TMPL_MAX_HEX_DIGITS)
+            {
+                return false;
+            }
+            for (NDigits = 0; NDigits < Width; NDigits++, Value >>= 4)
+            {
+                Digits[NDigits] = Hex[Value & 0xF];
+            }
+        }
+        else
+        {
+            Negative = (Value & 1) != 0;
+            Value    = (Value >> 1) ^ (0 - (Value & 1)); /* Undo the zigzag */
+            if (Negative)
+            {
+                Value = 0 - Value;
+            }
+
+            if (Tag == ROS_APP_TMPL_TAG_DEC)
+            {
+                if (Arg > ROS_APP_TMPL_MAX_DEC_DIGITS)
+                {
+                    return false;
+                }
+                Point = Arg;
+            }
+            Width   = Point + 1;
+            NDigits = 0;
+            do
+            {
+                Digits[NDigits++] = (char)('0' + Value % 10);
+                Value /= 10;
+            } while (Value != 0 || NDigits < Width);
+        }
+
+        if (OutBytes + NDigits + (Negative ? 1 : 0) + (Point != 0 ? 1 : 0) + (Tag == ROS_APP_TMPL_TAG_HEX ? 2 : 0) >=
+            OutSize)
+        {
+            return false;
+        }
+        if (Negative)
+        {
+            Out[OutBytes++] = '-';
+        }
+        if (Tag == ROS_APP_TMPL_TAG_HEX)
+        {
+            Out[OutBytes++] = '0';
+            Out[OutBytes++] = 'x';
+        }
+        for (i = NDigits; i > 0; i--)
+        {
+            if (Point != 0 && i == Point)
+            {
+                Out[OutBytes++] = '.';
+            }
+            Out[OutBytes++] = Digits[i - 1];
+        }
+    }
+
+    if (Pos != ParamBytes)
+    {
+        return false;
+    }
+
+    Out[OutBytes] = 0;
+    return true;
+
+} /* End of ROS_APP_Tmpl_Expand() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_Decode                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Rebuilds a msg from a reference into this table.  Fails if the     */
+/*         template has since been evicted.                                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool ROS_APP_Tmpl_Decode(const ROS_APP_Tmpl_t *Tmpl, const ROS_APP_TmplRef_t *Ref, const uint8 *Params,
+                         uint32 ParamBytes, char *Out, uint32 OutSize)
+{
+    const ROS_APP_TmplEntry_t *Entry;
+
+    if (Ref->TemplateId >= ROS_APP_TMPL_MAX_TEMPLATES)
+    {
+        return false;
+    }
+
+    Entry = &Tmpl->Entries[Ref->TemplateId];
+    if (!Entry->InUse || Entry->Generation != Ref->Generation)
+    {
+        return false;
+    }
+
+    return ROS_APP_Tmpl_Expand(Entry->Text, Entry->TextBytes, Params, ParamBytes, Out, OutSize);
+
+} /* End of ROS_APP_Tmpl_Decode() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_BuildDef                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Fills in the definition packet for a template.                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Tmpl_BuildDef(const ROS_APP_Tmpl_t *Tmpl, const ROS_APP_TmplRef_t *Ref, ROS_APP_TmplDef_Payload_t *Def)
+{
+    const ROS_APP_TmplEntry_t *Entry = &Tmpl->Entries[Ref->TemplateId];
+
+    Def->Ref        = *Ref;
+    Def->TextBytes  = Entry->TextBytes;
+    Def->ParamCount = Entry->ParamCount;
+    memset(Def->Text, 0, sizeof(Def->Text));
+    memcpy(Def->Text, Entry->Text, Entry->TextBytes);
+
+} /* End of ROS_APP_Tmpl_BuildDef() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_SetAnnounced                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Records that a template's definition has been queued, so later     */
+/*         records using it no longer report NeedsDef.                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Tmpl_SetAnnounced(ROS_APP_Tmpl_t *Tmpl, const ROS_APP_TmplRef_t *Ref)
+{
+    Tmpl->Entries[Ref->TemplateId].Announced = true;
+
+} /* End of ROS_APP_Tmpl_SetAnnounced() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_ResetStats                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the counters.  The templates are kept.                      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Tmpl_ResetStats(ROS_APP_Tmpl_t *Tmpl)
+{
+    uint16 InUse = Tmpl->Tlm.Payload.TemplatesInUse;
+
+    memset(&Tmpl->Tlm.Payload, 0, sizeof(Tmpl->Tlm.Payload));
+    Tmpl->Tlm.Payload.TemplatesInUse = InUse;
+
+} /* End of ROS_APP_Tmpl_ResetStats() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_Tmpl_SendTlm                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the hit rate and byte savings.                               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_Tmpl_SendTlm(ROS_APP_Tmpl_t *Tmpl)
+{
+    ROS_APP_TmplTlm_Payload_t *Payload = &Tmpl->Tlm.Payload;
+
+    Payload->HitRatePermille =
+        (Payload->Records == 0) ? 0 : (uint16)(((uint64)Payload->Hits * 1000) / Payload->Records);
+    Payload->BytesSaved = (int32)(Payload->BytesIn - Payload->BytesOut);
+
+    CFE_SB_TimeStampMsg(&Tmpl->Tlm.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&Tmpl->Tlm.TlmHeader.Msg, true);
+
+} /* End of ROS_APP_Tmpl_SendTlm() */
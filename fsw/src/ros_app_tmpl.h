@@ -0,0 +1,126 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_tmpl.h
+**
+** Purpose:
+**   Online template extraction for /rosout msg text.
+**
+** Notes:
+**   Numeric and hex tokens in a msg are replaced by a slot marker; what is
+**   left is the template.  Templates live in a bounded table and a record
+**   can then travel as a template ID plus its packed parameters.  When the
+**   table is full the clock hand evicts a template that has not been used
+**   since its last pass, and the slot's Generation is bumped so that old
+**   and new users of the same ID can be told apart.
+**
+**   A packed parameter is a tag byte, then:
+**     INT   zigzag varint of the value
+**     DEC   zigzag varint of the digits without the point; the tag holds
+**           the number of digits after the point
+**     HEX   varint of the value; the tag holds the digit count and case
+**     RAW   the token text; the tag holds its length
+**   Tokens that the compact forms would not rebuild byte for byte, such as
+**   "007" or "-0", are sent RAW, so ROS_APP_Tmpl_Expand always gives back
+**   the original text.
+**
+*******************************************************************************/
+#ifndef _ros_app_tmpl_h_
+#define _ros_app_tmpl_h_
+
+#include "cfe.h"
+#include "ros_app_msg.h"
+#include "ros_app_platform_cfg.h"
+
+/*
+** Stands for one parameter in template text.  A msg that already
+** contains it is not templated.
+*/
+#define ROS_APP_TMPL_SLOT ((char)0x1A)
+
+#define ROS_APP_TMPL_TAG_TYPE_MASK 0xC0
+#define ROS_APP_TMPL_TAG_ARG_MASK  0x3F
+#define ROS_APP_TMPL_TAG_INT       0x00
+#define ROS_APP_TMPL_TAG_DEC       0x40
+#define ROS_APP_TMPL_TAG_HEX       0x80
+#define ROS_APP_TMPL_TAG_RAW       0xC0
+#define ROS_APP_TMPL_HEX_UPPER     0x20 /* In the HEX tag argument, above the digit count */
+
+#define ROS_APP_TMPL_NO_ENTRY 0xFFFF
+
+/*
+** One template
+*/
+typedef struct
+{
+    uint32 Hash;
+    uint16 NextInBucket;
+    uint16 Generation;
+    uint16 TextBytes;
+    uint8  ParamCount;
+    uint8  spare;
+    bool   Referenced;
+    bool   Announced;
+    bool   InUse;
+    uint32 Hits;
+    char   Text[ROS_APP_ROSOUT_TLM_MSG_BYTES];
+
+} ROS_APP_TmplEntry_t;
+
+/*
+** Template table state
+*/
+typedef struct
+{
+    bool Forward; /* Send templated records instead of full text */
+
+    uint16              Buckets[ROS_APP_TMPL_HASH_BUCKETS];
+    ROS_APP_TmplEntry_t Entries[ROS_APP_TMPL_MAX_TEMPLATES];
+    uint32              ClockHand;
+
+    /*
+    ** Scratch for the template being built
+    */
+    char Text[ROS_APP_ROSOUT_TLM_MSG_BYTES];
+
+    ROS_APP_TmplTlm_t Tlm;
+
+} ROS_APP_Tmpl_t;
+
+/*
+** Exported functions
+*/
+void ROS_APP_Tmpl_Init(ROS_APP_Tmpl_t *Tmpl, uint32 MidOffset);
+bool ROS_APP_Tmpl_Encode(ROS_APP_Tmpl_t *Tmpl, const char *Msg, uint32 MsgBytes, ROS_APP_TmplRef_t *Ref,
+                         uint8 *Params, uint16 *ParamBytes, bool *NeedsDef);
+bool ROS_APP_Tmpl_Expand(const char *Text, uint32 TextBytes, const uint8 *Params, uint32 ParamBytes, char *Out,
+                         uint32 OutSize);
+bool ROS_APP_Tmpl_Decode(const ROS_APP_Tmpl_t *Tmpl, const ROS_APP_TmplRef_t *Ref, const uint8 *Params,
+                         uint32 ParamBytes, char *Out, uint32 OutSize);
+void ROS_APP_Tmpl_BuildDef(const ROS_APP_Tmpl_t *Tmpl, const ROS_APP_TmplRef_t *Ref, ROS_APP_TmplDef_Payload_t *Def);
+void ROS_APP_Tmpl_SetAnnounced(ROS_APP_Tmpl_t *Tmpl, const ROS_APP_TmplRef_t *Ref);
+void ROS_APP_Tmpl_ResetStats(ROS_APP_Tmpl_t *Tmpl);
+void ROS_APP_Tmpl_SendTlm(ROS_APP_Tmpl_t *Tmpl);
+
+#endif /* _ros_app_tmpl_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,183 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_utils.c
+**
+** Purpose:
+**   Small helpers shared by the ros App modules.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#include "ros_app_utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_GetTimeUsec                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns a monotonic-enough PSP timestamp in microseconds for       */
+/*         measuring intervals.  Not related to cFE spacecraft time.          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint64 ROS_APP_GetTimeUsec(void)
+{
+    OS_time_t Now;
+
+    CFE_PSP_GetTime(&Now);
+
+    return (uint64)OS_TimeGetTotalMicroseconds(Now);
+
+} /* End of ROS_APP_GetTimeUsec() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_TimeDeltaUsec                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Difference between two cFE times in microseconds, saturated to     */
+/*         0 when Later precedes Earlier and to UINT32_MAX on overflow.       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint32 ROS_APP_TimeDeltaUsec(CFE_TIME_SysTime_t Later, CFE_TIME_SysTime_t Earlier)
+{
+    CFE_TIME_SysTime_t Delta;
+    uint64             Usec;
+
+    if (Later.Seconds < Earlier.Seconds ||
+        (Later.Seconds == Earlier.Seconds && Later.Subseconds < Earlier.Subseconds))
+    {
+        return 0;
+    }
+
+    Delta = CFE_TIME_Subtract(Later, Earlier);
+    Usec  = ((uint64)Delta.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Delta.Subseconds);
+
+    if (Usec > 0xFFFFFFFF)
+    {
+        Usec = 0xFFFFFFFF;
+    }
+
+    return (uint32)Usec;
+
+} /* End of ROS_APP_TimeDeltaUsec() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_LevelToSeverity                                            */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Maps a /rosout level to a ROS_APP_SEVERITY_* class.  Accepts the   */
+/*         ROS 1 bit values (1, 2, 4, 8, 16) as well as the ROS 2             */
+/*         rcl_interfaces/Log values (10, 20, 30, 40, 50).                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+uint8 ROS_APP_LevelToSeverity(uint8 Level)
+{
+    switch (Level)
+    {
+        case 1:
+            return ROS_APP_SEVERITY_DEBUG;
+        case 2:
+            return ROS_APP_SEVERITY_INFO;
+        case 4:
+            return ROS_APP_SEVERITY_WARN;
+        case 8:
+            return ROS_APP_SEVERITY_ERROR;
+        case 16:
+            return ROS_APP_SEVERITY_FATAL;
+        default:
+            break;
+    }
+
+    if (Level >= 50)
+    {
+        return ROS_APP_SEVERITY_FATAL;
+    }
+    if (Level >= 40)
+    {
+        return ROS_APP_SEVERITY_ERROR;
+    }
+    if (Level >= 30)
+    {
+        return ROS_APP_SEVERITY_WARN;
+    }
+    if (Level >= 20)
+    {
+        return ROS_APP_SEVERITY_INFO;
+    }
+
+    return ROS_APP_SEVERITY_DEBUG;
+
+} /* End of ROS_APP_LevelToSeverity() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_HashName                                                   */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         32-bit FNV-1a hash of a node name, stopping at the NUL or after    */
+/*         MaxBytes.                                                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint32 ROS_APP_HashName(const char *Name, uint32 MaxBytes)
+{
+    uint32 Hash = 2166136261u;
+    uint32 i;
+
+    for (i = 0; i < MaxBytes && Name[i] != 0; i++)
+    {
+        Hash ^= (uint8)Name[i];
+        Hash *= 16777619u;
+    }
+
+    return Hash;
+
+} /* End of ROS_APP_HashName() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  ROS_APP_InstanceName                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Builds the name of a per-instance object.  Instance 0 uses         */
+/*         BaseName as is; other instances get their number appended, or      */
+/*         inserted before the extension of a file name, so that              */
+/*         "/cf/ros_app_tbl.tbl" becomes "/cf/ros_app_tbl2.tbl".              */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void ROS_APP_InstanceName(char *Name, size_t NameSize, const char *BaseName, uint32 Instance)
+{
+    const char *Ext = strrchr(BaseName, '.');
+
+    if (Instance == 0)
+    {
+        snprintf(Name, NameSize, "%s", BaseName);
+    }
+    else if (Ext != NULL && strchr(Ext, '/') == NULL)
+    {
+        snprintf(Name, NameSize, "%.*s%lu%s", (int)(Ext - BaseName), BaseName, (unsigned long)Instance, Ext);
+    }
+    else
+    {
+        snprintf(Name, NameSize, "%s%lu", BaseName, (unsigned long)Instance);
+    }
+
+} /* End of ROS_APP_InstanceName() */
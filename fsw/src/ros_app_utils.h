@@ -0,0 +1,46 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_utils.h
+**
+** Purpose:
+**   Small helpers shared by the ros App modules.
+**
+*******************************************************************************/
+#ifndef _ros_app_utils_h_
+#define _ros_app_utils_h_
+
+#include "cfe.h"
+#include "ros_app_mission_cfg.h"
+
+/*
+** Exported functions
+*/
+uint64 ROS_APP_GetTimeUsec(void);
+uint32 ROS_APP_TimeDeltaUsec(CFE_TIME_SysTime_t Later, CFE_TIME_SysTime_t Earlier);
+uint8  ROS_APP_LevelToSeverity(uint8 Level);
+uint32 ROS_APP_HashName(const char *Name, uint32 MaxBytes);
+void   ROS_APP_InstanceName(char *Name, size_t NameSize, const char *BaseName, uint32 Instance);
+
+#endif /* _ros_app_utils_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
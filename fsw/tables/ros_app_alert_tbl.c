@@ -0,0 +1,45 @@
+/*
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+*/
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "ros_app_alert_table.h"
+
+/*
+** Default alert patterns.  Unlisted entries are unused.
+*/
+ROS_APP_AlertTable_t RosAppAlertTbl = {
+    .EventHoldoffMs = 1000,
+    .Patterns       = {
+        { .Text = "overcurrent", .MinSeverity = ROS_APP_SEVERITY_WARN },
+        { .Text = "estop",       .MinSeverity = ROS_APP_SEVERITY_DEBUG },
+        { .Text = "NaN",         .MinSeverity = ROS_APP_SEVERITY_DEBUG },
+    },
+};
+
+/*
+** The macro below identifies:
+**    1) the data structure type to use as the table image format
+**    2) the name of the table to be placed into the cFE Table File Header
+**    3) a brief description of the contents of the file image
+**    4) the desired name of the table image binary file that is cFE compatible
+*/
+CFE_TBL_FILEDEF(RosAppAlertTbl, ROS_APP.RosAppAlertTbl, rosout alert patterns, ros_app_alert_tbl.tbl)
@@ -27,7 +27,46 @@
 ** The following is an example of the declaration statement that defines the desired
 ** contents of the table image.
 */
-ROS_APP_Table_t RosAppTable = {1, 2};
+ROS_APP_Table_t RosAppTable = {
+    .Int1 = 1,
+    .Int2 = 2,
+
+    .DownlinkBytesPerTick = 8192,
+    .DownlinkWeights      = {
+        [ROS_APP_SEVERITY_DEBUG] = 1,
+        [ROS_APP_SEVERITY_INFO]  = 2,
+        [ROS_APP_SEVERITY_WARN]  = 4,
+    },
+
+    .SampleRates = {
+        [ROS_APP_SEVERITY_DEBUG] = 10,
+        [ROS_APP_SEVERITY_INFO]  = 1,
+        [ROS_APP_SEVERITY_WARN]  = 1,
+    },
+
+    .TemplateForward = 0,
+
+    .EvsForward     = 0,
+    .EvsMinSeverity = ROS_APP_SEVERITY_INFO,
+    .EvsBurst       = 20,
+    .EvsRatePerSec  = 10,
+    .EvsFilters     = {
+        /* Our own events would come back if the bridge feeds them to /rosout */
+        {.App = "ROS_APP", .MinSeverity = ROS_APP_SEVERITY_COUNT},
+    },
+
+    .FlowHighPct   = 75,
+    .FlowLowPct    = 25,
+    .FlowTargetPct = 80,
+
+    .RollupIntervalSec = 60,
+
+    /* Keep everything until nodes are listed */
+    .DefaultMinSeverity = ROS_APP_SEVERITY_DEBUG,
+
+    /* Only listed nodes are watched */
+    .DefaultSilenceMs = 0,
+};
 
 /*
 ** The macro below identifies:
@@ -0,0 +1,346 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ros_app_sanitize_bench.c
+**
+** Purpose:
+**   Host check of the vector /rosout sanitizer against the scalar one,
+**   and a timing of both over realistic records.
+**
+** Notes:
+**   Built by ros_app_sanitize_bench.sh, which compiles ros_app_sanitize.c
+**   twice: once as is, with its functions renamed to Vec_*, and once with
+**   ROS_APP_SANITIZE_SCALAR, renamed to Scl_*.  Exits non-zero on the
+**   first case where the two disagree.
+**
+*******************************************************************************/
+
+/*
+** Include Files:
+*/
+#define _POSIX_C_SOURCE 199309L
+
+#include "ros_app_sanitize.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+bool Vec_SanitizeField(char *Dst, const char *Src, size_t Size, bool *Truncated);
+bool Vec_SanitizeRosout(ROS_APP_Rosout_Payload_t *Dst, const ROS_APP_Rosout_Payload_t *Src);
+bool Scl_SanitizeField(char *Dst, const char *Src, size_t Size, bool *Truncated);
+bool Scl_SanitizeRosout(ROS_APP_Rosout_Payload_t *Dst, const ROS_APP_Rosout_Payload_t *Src);
+
+#define BENCH_MAX_FIELD    300
+#define BENCH_RANDOM_CASES 1000000
+#define BENCH_RECORDS      1024
+#define BENCH_PASSES       2000
+
+static uint32 BenchSeed = 12345;
+static uint32 BenchCases;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  BenchRand                                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         xorshift32, so runs repeat on every host.                          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static uint32 BenchRand(void)
+{
+    BenchSeed ^= BenchSeed << 13;
+    BenchSeed ^= BenchSeed >> 17;
+    BenchSeed ^= BenchSeed << 5;
+
+    return BenchSeed;
+
+} /* End of BenchRand() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  BenchByte                                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns a random byte, weighted toward the bytes either side of    */
+/*         each boundary the sanitizer tests.                                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static char BenchByte(void)
+{
+    static const uint8 Edges[] = {0x00, 0x01, 0x09, 0x0A, 0x1F, 0x20, 0x21, 0x7E, 0x7F, 0x80, 0xC3, 0xFF};
+    uint32             Pick    = BenchRand();
+
+    if (Pick % 4 == 0)
+    {
+        return (char)Edges[(Pick >> 8) % sizeof(Edges)];
+    }
+
+    return (char)(Pick >> 8);
+
+} /* End of BenchByte() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  BenchCompare                                                       */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Runs both builds on one field, copied out and in place, and        */
+/*         exits if the output, Truncated or the return value differ.         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void BenchCompare(const char *Src, size_t Size, const char *What)
+{
+    char   VecOut[BENCH_MAX_FIELD];
+    char   SclOut[BENCH_MAX_FIELD];
+    bool   VecTrunc;
+    bool   SclTrunc;
+    bool   VecRet;
+    bool   SclRet;
+    uint32 InPlace;
+
+    for (InPlace = 0; InPlace < 2; InPlace++)
+    {
+        memset(VecOut, 0xA5, sizeof(VecOut));
+        memset(SclOut, 0xA5, sizeof(SclOut));
+        VecTrunc = false;
+        SclTrunc = false;
+
+        if (InPlace)
+        {
+            memcpy(VecOut, Src, Size);
+            memcpy(SclOut, Src, Size);
+            VecRet = Vec_SanitizeField(VecOut, VecOut, Size, &VecTrunc);
+            SclRet = Scl_SanitizeField(SclOut, SclOut, Size, &SclTrunc);
+        }
+        else
+        {
+            VecRet = Vec_SanitizeField(VecOut, Src, Size, &VecTrunc);
+            SclRet = Scl_SanitizeField(SclOut, Src, Size, &SclTrunc);
+        }
+
+        if (VecRet != SclRet || VecTrunc != SclTrunc || memcmp(VecOut, SclOut, sizeof(VecOut)) != 0)
+        {
+            printf("FAIL: %s, size %u%s: returned %d/%d, truncated %d/%d\n", What, (unsigned)Size,
+                   InPlace ? ", in place" : "", VecRet, SclRet, VecTrunc, SclTrunc);
+            exit(1);
+        }
+
+        BenchCases++;
+    }
+
+} /* End of BenchCompare() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  BenchCheck                                                         */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Boundary cases for every size up to BENCH_MAX_FIELD, then random   */
+/*         fields.                                                            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void BenchCheck(void)
+{
+    static const uint8 Edges[] = {0x1F, 0x20, 0x7E, 0x7F, 0x80, 0xFF};
+    char               Src[BENCH_MAX_FIELD];
+    size_t             Size;
+    size_t             Pos;
+    uint32             i;
+    uint32             Byte;
+
+    for (Size = 1; Size <= BENCH_MAX_FIELD; Size++)
+    {
+        /* No NUL at all */
+        memset(Src, 'a', Size);
+        BenchCompare(Src, Size, "no NUL");
+
+        /* NUL in every lane, with text and with a control byte before it */
+        for (Pos = 0; Pos < Size; Pos++)
+        {
+            memset(Src, 'a', Size);
+            Src[Pos] = 0;
+            BenchCompare(Src, Size, "NUL position");
+
+            if (Pos > 0)
+            {
+                Src[Pos - 1] = 0x1F;
+                BenchCompare(Src, Size, "control before NUL");
+            }
+        }
+
+        /* Each boundary byte in every lane */
+        for (Byte = 0; Byte < sizeof(Edges); Byte++)
+        {
+            for (Pos = 0; Pos < Size; Pos++)
+            {
+                memset(Src, 'a', Size);
+                Src[Pos] = (char)Edges[Byte];
+                BenchCompare(Src, Size, "boundary byte");
+            }
+        }
+    }
+
+    for (i = 0; i < BENCH_RANDOM_CASES; i++)
+    {
+        Size = 1 + BenchRand() % BENCH_MAX_FIELD;
+        for (Pos = 0; Pos < Size; Pos++)
+        {
+            Src[Pos] = BenchByte();
+        }
+
+        /* Mostly clean text, so runs past the first block are common */
+        if (i % 2 == 0)
+        {
+            for (Pos = 0; Pos < Size; Pos++)
+            {
+                if (BenchRand() % 64 != 0)
+                {
+                    Src[Pos] = (char)(0x20 + BenchRand() % 0x5F);
+                }
+            }
+        }
+
+        BenchCompare(Src, Size, "random");
+    }
+
+} /* End of BenchCheck() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  BenchFill                                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Writes Len printable bytes and a NUL, then stale bytes after it.   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void BenchFill(char *Field, size_t Size, size_t Len)
+{
+    size_t i;
+
+    for (i = 0; i < Size; i++)
+    {
+        Field[i] = (i < Len) ? (char)(0x20 + BenchRand() % 0x5F) : (char)BenchRand();
+    }
+
+    Field[Len] = 0;
+
+} /* End of BenchFill() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  BenchTime                                                          */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Returns the ns per record one build takes over the record set.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static double BenchTime(bool (*Sanitize)(ROS_APP_Rosout_Payload_t *, const ROS_APP_Rosout_Payload_t *),
+                        const ROS_APP_Rosout_Payload_t *Records, ROS_APP_Rosout_Payload_t *Out)
+{
+    struct timespec Start;
+    struct timespec End;
+    uint32          Pass;
+    uint32          i;
+    uint32          Repaired = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+
+    for (Pass = 0; Pass < BENCH_PASSES; Pass++)
+    {
+        for (i = 0; i < BENCH_RECORDS; i++)
+        {
+            Repaired += Sanitize(&Out[i], &Records[i]);
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    /* Keep the calls from being optimized away */
+    if (Repaired == 0xFFFFFFFF)
+    {
+        printf("\n");
+    }
+
+    return ((double)(End.tv_sec - Start.tv_sec) * 1e9 + (double)(End.tv_nsec - Start.tv_nsec)) /
+           ((double)BENCH_PASSES * BENCH_RECORDS);
+
+} /* End of BenchTime() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  BenchRun                                                           */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Times both builds over records shaped like typical ROS logging:    */
+/*         short node names, 16 to 100 byte messages, source paths and        */
+/*         function names, with an occasional tab or stray control byte.      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void BenchRun(void)
+{
+    static ROS_APP_Rosout_Payload_t Records[BENCH_RECORDS];
+    static ROS_APP_Rosout_Payload_t VecOut[BENCH_RECORDS];
+    static ROS_APP_Rosout_Payload_t SclOut[BENCH_RECORDS];
+    ROS_APP_Rosout_Payload_t       *Rec;
+    double                          VecNs;
+    double                          SclNs;
+    uint32                          i;
+
+    for (i = 0; i < BENCH_RECORDS; i++)
+    {
+        Rec = &Records[i];
+        BenchFill(Rec->name, sizeof(Rec->name), 6 + BenchRand() % 14);
+        BenchFill(Rec->msg, sizeof(Rec->msg), 16 + BenchRand() % 85);
+        BenchFill(Rec->file, sizeof(Rec->file), 20 + BenchRand() % 40);
+        BenchFill(Rec->function, sizeof(Rec->function), 8 + BenchRand() % 16);
+
+        if (i % 50 == 0)
+        {
+            Rec->msg[BenchRand() % 16] = '\t';
+        }
+    }
+
+    /* Warm up, and check the whole records agree */
+    for (i = 0; i < BENCH_RECORDS; i++)
+    {
+        if (Vec_SanitizeRosout(&VecOut[i], &Records[i]) != Scl_SanitizeRosout(&SclOut[i], &Records[i]) ||
+            memcmp(&VecOut[i], &SclOut[i], sizeof(VecOut[i])) != 0)
+        {
+            printf("FAIL: record %u differs\n", (unsigned)i);
+            exit(1);
+        }
+    }
+
+    VecNs = BenchTime(Vec_SanitizeRosout, Records, VecOut);
+    SclNs = BenchTime(Scl_SanitizeRosout, Records, SclOut);
+
+    printf("vector %.1f ns/record, scalar %.1f ns/record, speedup %.2fx\n", VecNs, SclNs, SclNs / VecNs);
+
+} /* End of BenchRun() */
+
+int main(void)
+{
+    BenchCheck();
+    printf("%u field cases match\n", (unsigned)BenchCases);
+
+    BenchRun();
+
+    return 0;
+
+} /* End of main() */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,49 @@
+#!/bin/sh
+#
+# Host equivalence test and benchmark for the /rosout sanitizer.
+#
+# Compiles fsw/src/ros_app_sanitize.c twice, once as is (SSE2 or NEON when
+# the host has it) and once with ROS_APP_SANITIZE_SCALAR, links both into
+# ros_app_sanitize_bench.c and runs it.  The run fails if the two builds
+# disagree on any field, then prints ns per record for each and the
+# speedup.
+#
+# The sanitizer only needs cFE's types and ros_app's message headers, so
+# INCLUDES must reach cfe.h and the headers it pulls in, e.g. from a built
+# cFS tree:
+#   CFS_DIR=~/cFS ./ros_app_sanitize_bench.sh
+# or with an explicit list:
+#   INCLUDES="-I/path/to/cfe/inc -I/path/to/osal/inc" ./ros_app_sanitize_bench.sh
+#
+
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:-"-O2"}
+CFS_DIR=${CFS_DIR:-$(dirname "$0")/../../..}
+BUILD_DIR=${BUILD_DIR:-$CFS_DIR/build}
+INCLUDES=${INCLUDES:-"-I$CFS_DIR/cfe/modules/core_api/fsw/inc -I$CFS_DIR/osal/src/os/inc \
+-I$BUILD_DIR/inc -I$BUILD_DIR/native/default_cpu1/inc -I$BUILD_DIR/osal_public_api/inc"}
+OUT=${OUT:-${TMPDIR:-/tmp}/ros_app_sanitize_bench}
+
+APP_DIR=$(dirname "$0")/..
+APP_INC="-I$APP_DIR/fsw/src -I$APP_DIR/fsw/mission_inc -I$APP_DIR/fsw/platform_inc"
+
+mkdir -p "$OUT" || exit 1
+
+build() {
+    # $1 is the symbol prefix, the rest extra flags
+    prefix=$1
+    shift
+    $CC -std=c99 $CFLAGS $INCLUDES $APP_INC "$@" \
+        -DROS_APP_SanitizeRosout="${prefix}_SanitizeRosout" \
+        -DROS_APP_SanitizeRosoutLong="${prefix}_SanitizeRosoutLong" \
+        -DROS_APP_SanitizeField="${prefix}_SanitizeField" \
+        -c "$APP_DIR/fsw/src/ros_app_sanitize.c" -o "$OUT/$prefix.o"
+}
+
+build Vec || exit 1
+build Scl -DROS_APP_SANITIZE_SCALAR || exit 1
+
+$CC -std=c99 $CFLAGS $INCLUDES $APP_INC "$(dirname "$0")/ros_app_sanitize_bench.c" \
+    "$OUT/Vec.o" "$OUT/Scl.o" -o "$OUT/ros_app_sanitize_bench" || exit 1
+
+"$OUT/ros_app_sanitize_bench"
@@ -0,0 +1,70 @@
+#!/bin/sh
+#
+# Instance scaling benchmark for ros_app on a Linux cFS target.
+#
+# Build ros_app with ROS_APP_INSTANCE_COUNT set to at least INSTANCES.  For
+# each N from 1 to INSTANCES this starts a saturation sweep on instances
+# 0..N-1 at the same time, waits for N "load gen done" events in CFS_LOG
+# (the core-cpu1 console output) and prints the sum of the sustainable
+# rates.  Each instance's generator only counts what its own instance
+# processed, so the sum is the aggregate throughput at N instances.
+#
+# Every setting can be overridden from the environment, e.g.
+#   INSTANCES=4 MAX=200000 CFS_LOG=/tmp/cfs.log ./ros_app_scale.sh
+#
+
+CMDUTIL=${CMDUTIL:-cmdUtil}
+HOST=${HOST:-127.0.0.1}
+PORT=${PORT:-1234}
+ENDIAN=${ENDIAN:-LE}
+CMD_MID=${CMD_MID:-0x1896}        # ROS_APP_CMD_MID of instance 0 with the default CFE_PLATFORM_CMD_MID_BASE
+MID_STRIDE=${MID_STRIDE:-0x100}   # ROS_APP_INSTANCE_MID_STRIDE
+START_LOADGEN_CC=8
+
+INSTANCES=${INSTANCES:-4}         # largest instance count to measure
+RATE=${RATE:-1000}                # first rate, msg/s
+STEP=${STEP:-1000}                # increment per step, msg/s
+MAX=${MAX:-100000}                # give up above this rate, msg/s
+STEP_MS=${STEP_MS:-2000}          # time at each rate
+DROP_PPM=${DROP_PPM:-1000}        # losses per million that mark the knee
+MIN_LEN=${MIN_LEN:-16}            # msg text length range
+MAX_LEN=${MAX_LEN:-100}
+NODES=${NODES:-32}                # distinct node names
+WEIGHTS=${WEIGHTS:-"40 40 15 4 1"} # DEBUG INFO WARN ERROR FATAL
+CFS_LOG=${CFS_LOG:?set CFS_LOG to the cFS console output}
+
+set -- $WEIGHTS
+
+done_count() {
+    grep -c "load gen done" "$CFS_LOG"
+}
+
+echo "instances aggregate_msg_per_sec per_instance_msg_per_sec"
+
+n=1
+while [ "$n" -le "$INSTANCES" ]; do
+    before=$(done_count)
+
+    i=0
+    while [ "$i" -lt "$n" ]; do
+        mid=$(printf "0x%X" $((CMD_MID + i * MID_STRIDE)))
+
+        "$CMDUTIL" --host="$HOST" --port="$PORT" --endian="$ENDIAN" \
+            --pktid="$mid" --cmdcode="$START_LOADGEN_CC" \
+            --uint32="$RATE" --uint32="$STEP" --uint32="$MAX" --uint32="$STEP_MS" --uint32="$DROP_PPM" \
+            --uint16="$MIN_LEN" --uint16="$MAX_LEN" --uint16="$NODES" \
+            --uint8="$1" --uint8="$2" --uint8="$3" --uint8="$4" --uint8="$5" --uint8=0 >/dev/null || exit 1
+
+        i=$((i + 1))
+    done
+
+    until [ $(($(done_count) - before)) -ge "$n" ]; do
+        sleep 1
+    done
+
+    grep "load gen done" "$CFS_LOG" | tail -n "$n" |
+        sed -n 's/.*sustainable \([0-9]*\) msg\/s.*/\1/p' |
+        awk -v n="$n" '{ sum += $1 } END { printf "%9d %23d %24d\n", n, sum, sum / n }'
+
+    n=$((n + 1))
+done
@@ -0,0 +1,54 @@
+#!/bin/sh
+#
+# Saturation sweep for ros_app on a Linux cFS target.
+#
+# Sends ROS_APP_START_LOADGEN_CC with cmdUtil from cFS-GroundSystem and,
+# when CFS_LOG points at the core-cpu1 console output, waits for the
+# "load gen done" event and prints the sustainable rate and knee.  The
+# per-step curve is in ROS_APP_LOADGEN_TLM_MID.  Run once with OBEY=0 and
+# once with OBEY=1 to compare StepDropPpm with and without the generator
+# following ROS_APP_FLOW_CTL_MID.
+#
+# Every setting can be overridden from the environment, e.g.
+#   RATE=500 STEP=500 MAX=50000 CFS_LOG=/tmp/cfs.log ./ros_app_sweep.sh
+#
+
+CMDUTIL=${CMDUTIL:-cmdUtil}
+HOST=${HOST:-127.0.0.1}
+PORT=${PORT:-1234}
+ENDIAN=${ENDIAN:-LE}
+CMD_MID=${CMD_MID:-0x1896}        # ROS_APP_CMD_MID with the default CFE_PLATFORM_CMD_MID_BASE
+START_LOADGEN_CC=8
+
+RATE=${RATE:-1000}                # first rate, msg/s
+STEP=${STEP:-1000}                # increment per step, msg/s
+MAX=${MAX:-100000}                # give up above this rate, msg/s
+STEP_MS=${STEP_MS:-2000}          # time at each rate
+DROP_PPM=${DROP_PPM:-1000}        # losses per million that mark the knee
+MIN_LEN=${MIN_LEN:-16}            # msg text length range
+MAX_LEN=${MAX_LEN:-100}
+NODES=${NODES:-32}                # distinct node names
+WEIGHTS=${WEIGHTS:-"40 40 15 4 1"} # DEBUG INFO WARN ERROR FATAL
+OBEY=${OBEY:-0}                   # 1 = follow ros_app's flow control advice like a bridge
+CFS_LOG=${CFS_LOG:-}
+
+set -- $WEIGHTS
+
+# Only events logged after the command count, not an earlier sweep's
+START_LINES=0
+[ -n "$CFS_LOG" ] && [ -f "$CFS_LOG" ] && START_LINES=$(wc -l < "$CFS_LOG")
+
+"$CMDUTIL" --host="$HOST" --port="$PORT" --endian="$ENDIAN" \
+    --pktid="$CMD_MID" --cmdcode="$START_LOADGEN_CC" \
+    --uint32="$RATE" --uint32="$STEP" --uint32="$MAX" --uint32="$STEP_MS" --uint32="$DROP_PPM" \
+    --uint16="$MIN_LEN" --uint16="$MAX_LEN" --uint16="$NODES" \
+    --uint8="$1" --uint8="$2" --uint8="$3" --uint8="$4" --uint8="$5" --uint8="$OBEY" || exit 1
+
+[ -n "$CFS_LOG" ] || exit 0
+
+echo "Waiting for the sweep to finish..."
+until tail -n +$((START_LINES + 1)) "$CFS_LOG" | grep -q "load gen done"; do
+    sleep 1
+done
+
+tail -n +$((START_LINES + 1)) "$CFS_LOG" | grep "load gen done" | tail -n 1